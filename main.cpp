@@ -7,6 +7,24 @@
 
 int main(int argc, char* argv[]) {
     std::cout<< std::unitbuf;
+
+    // "--threads N" may appear anywhere; strip it so the positional arguments of every mode stay unchanged.
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") != 0)
+            continue;
+        const int threads = i + 1 < argc ? std::atoi(argv[i + 1]) : 0;
+        if (threads < 1) {
+            std::cerr << "[ERROR] --threads expects a positive thread count." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        SortManager::setThreadCount(threads);
+        for (int j = i; j + 2 <= argc; ++j)
+            argv[j] = argv[j + 2];
+        argc -= 2;
+        break;
+    }
+
     if (argc < 2 || std::strcmp(argv[1], "--help") == 0) {
         HelpMessage::printHelp();
         return 0;
@@ -37,6 +55,36 @@ int main(int argc, char* argv[]) {
             return 1;
         }
     }
+    else if (mode == "--externalSort") {
+        if (argc != 8) {
+            std::cerr << "[ERROR] Invalid number of arguments for --externalSort mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        const char* algFlag    = argv[2];
+        const char* typeFlag   = argv[3];
+        const char* inputFile  = argv[4];
+        const char* outputFile = argv[5];
+        double memoryMB        = std::atof(argv[6]);
+        int fanIn              = std::atoi(argv[7]);
+
+        if (memoryMB <= 0.0 || fanIn < 2) {
+            std::cerr << "[ERROR] --externalSort expects a positive memory budget and a fan-in of at least 2." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        if (std::strcmp(typeFlag, "--i") == 0)
+            SortManager::externalSortMode<int>(algFlag, inputFile, outputFile, memoryMB, fanIn);
+        else if (std::strcmp(typeFlag, "--f") == 0)
+            SortManager::externalSortMode<float>(algFlag, inputFile, outputFile, memoryMB, fanIn);
+        else if (std::strcmp(typeFlag, "--d") == 0)
+            SortManager::externalSortMode<double>(algFlag, inputFile, outputFile, memoryMB, fanIn);
+        else {
+            std::cerr << "[ERROR] Invalid type flag: " << typeFlag << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+    }
     else if (mode == "--benchmark") {
         if (argc < 6) {
             std::cerr << "[ERROR] Not enough arguments for --benchmark mode." << std::endl;
@@ -186,6 +234,73 @@ int main(int argc, char* argv[]) {
 
         SortManager::studyVaryTypes(algFlag, repeatCount, writeFlag, outputFile);
     }
+    else if (mode == "--accessBenchmark") {
+        if (argc != 5) {
+            std::cerr << "[ERROR] Invalid number of arguments for --accessBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        const char* typeFlag    = argv[2];
+        int dataLength  = std::atoi(argv[3]);
+        int repeatCount = std::atoi(argv[4]);
+
+        if      (std::strcmp(typeFlag, "--i") == 0)
+            SortManager::accessPolicyBenchmark<int>(dataLength, repeatCount, 0, 1000);
+        else if (std::strcmp(typeFlag, "--f") == 0)
+            SortManager::accessPolicyBenchmark<float>(dataLength, repeatCount, 0.0f, 1000.0f);
+        else if (std::strcmp(typeFlag, "--d") == 0)
+            SortManager::accessPolicyBenchmark<double>(dataLength, repeatCount, 0.0, 1000.0);
+        else {
+            std::cerr << "[ERROR] Invalid type flag: " << typeFlag << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+    }
+    else if (mode == "--percentileBenchmark") {
+        if (argc != 5) {
+            std::cerr << "[ERROR] Invalid number of arguments for --percentileBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        const char* typeFlag    = argv[2];
+        int dataLength  = std::atoi(argv[3]);
+        int repeatCount = std::atoi(argv[4]);
+
+        if      (std::strcmp(typeFlag, "--i") == 0)
+            SortManager::percentileBenchmark<int>(dataLength, repeatCount, 0, 1000000000);
+        else if (std::strcmp(typeFlag, "--f") == 0)
+            SortManager::percentileBenchmark<float>(dataLength, repeatCount, 0.0f, 1000000.0f);
+        else if (std::strcmp(typeFlag, "--d") == 0)
+            SortManager::percentileBenchmark<double>(dataLength, repeatCount, 0.0, 1000000.0);
+        else {
+            std::cerr << "[ERROR] Invalid type flag: " << typeFlag << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+    }
+    else if (mode == "--parallelBenchmark") {
+        if (argc != 6) {
+            std::cerr << "[ERROR] Invalid number of arguments for --parallelBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        const char* algFlag     = argv[2];
+        const char* typeFlag    = argv[3];
+        int dataLength  = std::atoi(argv[4]);
+        int repeatCount = std::atoi(argv[5]);
+
+        if      (std::strcmp(typeFlag, "--i") == 0)
+            SortManager::parallelScalingBenchmark<int>(algFlag, dataLength, repeatCount, 0, 1000000);
+        else if (std::strcmp(typeFlag, "--f") == 0)
+            SortManager::parallelScalingBenchmark<float>(algFlag, dataLength, repeatCount, 0.0f, 1000000.0f);
+        else if (std::strcmp(typeFlag, "--d") == 0)
+            SortManager::parallelScalingBenchmark<double>(algFlag, dataLength, repeatCount, 0.0, 1000000.0);
+        else {
+            std::cerr << "[ERROR] Invalid type flag: " << typeFlag << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+    }
     else if (mode == "--gFile") {
         if (argc < 6) {
             std::cerr << "[ERROR] Not enough arguments for --gFile mode." << std::endl;
@@ -263,6 +378,43 @@ int main(int argc, char* argv[]) {
         GraphsManager::benchmarkMode(problemFlag, algorithmFlag, shapeFlag,
                                      verticesCount, density, repeatCount4, outputFile4);
     }
+    else if (mode == "--gAllocBenchmark") {
+        if (argc < 5 || argc > 6) {
+            std::cerr << "[ERROR] Invalid number of arguments for --gAllocBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        int verticesCount       = std::atoi(argv[2]);
+        double density          = std::atof(argv[3]);
+        int repeatCount         = std::atoi(argv[4]);
+        const char* outputFile  = argc == 6 ? argv[5] : "";
+        GraphsManager::allocationBenchmarkMode(verticesCount, density, repeatCount, outputFile);
+    }
+    else if (mode == "--gAdjBenchmark") {
+        if (argc < 5 || argc > 6) {
+            std::cerr << "[ERROR] Invalid number of arguments for --gAdjBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        int verticesCount       = std::atoi(argv[2]);
+        double density          = std::atof(argv[3]);
+        int repeatCount         = std::atoi(argv[4]);
+        const char* outputFile  = argc == 6 ? argv[5] : "";
+        GraphsManager::adjacencyBenchmarkMode(verticesCount, density, repeatCount, outputFile);
+    }
+    else if (mode == "--gQueueBenchmark") {
+        if (argc < 5) {
+            std::cerr << "[ERROR] Not enough arguments for --gQueueBenchmark mode." << std::endl;
+            HelpMessage::printHelp();
+            return 1;
+        }
+        int verticesCount       = std::atoi(argv[2]);
+        int repeatCount         = std::atoi(argv[3]);
+        Vektor<double> densities;
+        for (int i = 4; i < argc; ++i)
+            densities.push_back(std::atof(argv[i]));
+        GraphsManager::queueBenchmarkMode(verticesCount, repeatCount, densities);
+    }
     else {
         std::cerr << "[ERROR] Unknown mode: " << mode << std::endl;
         HelpMessage::printHelp();
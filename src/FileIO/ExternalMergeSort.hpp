@@ -0,0 +1,289 @@
+#ifndef EXTERNAL_MERGE_SORT_HPP
+#define EXTERNAL_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../HeapImpl/LoserTree.hpp"
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Time and volume statistics of one external sort.
+ * I/O covers parsing the input, writing and reading run files and writing the output;
+ * CPU covers sorting the chunks and the loser-tree merging.
+ */
+struct ExternalSortStats {
+    long long elements = 0;
+    int runs = 0;
+    int mergePasses = 0;
+    double ioMs = 0.0;
+    double cpuMs = 0.0;
+};
+
+/**
+ * Sorts a text file in the FileIO format (element count, then one value per line) that does not fit in memory.
+ *
+ * 1. The input is streamed in chunks of memoryBudgetBytes; each chunk is sorted in memory with the given
+ *    sorter and spilled as a binary run file into a temporary directory.
+ * 2. While more than fanIn runs exist, groups of fanIn runs are merged into longer runs.
+ * 3. The last fanIn or fewer runs are merged with a loser tree straight into the text output.
+ * During merges the budget is split evenly between the input buffers and the output buffer.
+ */
+template <typename T>
+class ExternalMergeSort {
+public:
+    /**
+     * Returns false when a file cannot be opened or written.
+     * Time complexity: O(n log n) comparisons, ceil(log_fanIn(runs)) + 1 passes over the data on disk.
+     */
+    template <typename Sorter>
+    static bool sort(const std::string& inputFile, const std::string& outputFile, long long memoryBudgetBytes,
+                     int fanIn, Sorter&& sortChunk, ExternalSortStats& stats) {
+        stats = ExternalSortStats();
+        fanIn = std::max(fanIn, 2);
+        const int chunkElements = static_cast<int>(std::clamp<long long>(
+            memoryBudgetBytes / static_cast<long long>(sizeof(T)), 1, 1 << 30));
+
+        const std::filesystem::path runDirectory = createRunDirectory();
+        Vektor<std::string> runs;
+        bool ok = createRuns(inputFile, runDirectory, chunkElements, sortChunk, runs, stats);
+
+        // Intermediate passes until the final merge fits into one loser tree.
+        int generation = 0;
+        while (ok && runs.size() > fanIn) {
+            Vektor<std::string> merged;
+            for (int first = 0; first < runs.size() && ok; first += fanIn) {
+                const int last = std::min(first + fanIn, runs.size());
+                const std::string name = (runDirectory / ("pass" + std::to_string(generation) + "_"
+                                          + std::to_string(merged.size()) + ".bin")).string();
+                ok = mergeRuns(runs, first, last, chunkElements, BinaryWriter(name, stats), stats);
+                for (int i = first; i < last; ++i)
+                    std::filesystem::remove(runs[i]);
+                merged.push_back(name);
+            }
+            runs = std::move(merged);
+            ++stats.mergePasses;
+            ++generation;
+        }
+
+        if (ok) {
+            ok = mergeRuns(runs, 0, runs.size(), chunkElements, TextWriter(outputFile, stats.elements, stats), stats);
+            ++stats.mergePasses;
+        }
+
+        std::error_code ignored;
+        std::filesystem::remove_all(runDirectory, ignored);
+        return ok;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Runs action and adds its duration to the given counter.
+    template <typename Action>
+    static auto timed(double& milliseconds, Action&& action) {
+        const auto start = Clock::now();
+        struct Accumulate {
+            double& target;
+            Clock::time_point start;
+            ~Accumulate() {
+                target += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            }
+        } accumulate{milliseconds, start};
+        return action();
+    }
+
+    static std::filesystem::path createRunDirectory() {
+        std::random_device random;
+        const std::filesystem::path directory = std::filesystem::temp_directory_path()
+                                              / ("external_sort_" + std::to_string(random()));
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+
+    /// Phase 1: reads chunks, sorts them and writes one binary run file per chunk.
+    template <typename Sorter>
+    static bool createRuns(const std::string& inputFile, const std::filesystem::path& runDirectory, int chunkElements,
+                           Sorter& sortChunk, Vektor<std::string>& runs, ExternalSortStats& stats) {
+        std::ifstream input(inputFile);
+        if (!input) {
+            std::cerr << "Error: Cannot open input file " << inputFile << std::endl;
+            return false;
+        }
+        long long declared = 0;
+        input >> declared;
+
+        Vektor<T> chunk;
+        chunk.reserve(static_cast<int>(std::min<long long>(chunkElements, std::max<long long>(declared, 1))));
+        while (stats.elements < declared) {
+            chunk.clear();
+            timed(stats.ioMs, [&]() {
+                T value;
+                while (chunk.size() < chunkElements && stats.elements < declared && input >> value) {
+                    chunk.push_back(value);
+                    ++stats.elements;
+                }
+            });
+            if (chunk.empty()) break;
+
+            timed(stats.cpuMs, [&]() { sortChunk(chunk); });
+
+            const std::string name = (runDirectory / ("run" + std::to_string(runs.size()) + ".bin")).string();
+            const bool written = timed(stats.ioMs, [&]() {
+                std::ofstream run(name, std::ios::binary);
+                run.write(reinterpret_cast<const char*>(chunk.begin()),
+                          static_cast<std::streamsize>(sizeof(T)) * chunk.size());
+                return static_cast<bool>(run);
+            });
+            if (!written) {
+                std::cerr << "Error: Cannot write run file " << name << std::endl;
+                return false;
+            }
+            runs.push_back(name);
+        }
+        stats.runs = runs.size();
+        if (stats.elements < declared)
+            std::cerr << "[LOG] Input declared " << declared << " elements but contained " << stats.elements << std::endl;
+        return true;
+    }
+
+    /// Buffered sequential reader of one binary run file.
+    class RunReader {
+        std::ifstream file;
+        Vektor<T> buffer;
+        int position = 0;
+        int filled = 0;
+        ExternalSortStats* stats;
+
+    public:
+        RunReader(const std::string& name, int bufferElements, ExternalSortStats& statistics)
+            : file(name, std::ios::binary), buffer(bufferElements), stats(&statistics) {}
+
+        bool isOpen() const {
+            return static_cast<bool>(file);
+        }
+
+        bool next(T& value) {
+            if (position == filled && !refill()) return false;
+            value = buffer[position++];
+            return true;
+        }
+
+    private:
+        bool refill() {
+            return timed(stats->ioMs, [&]() {
+                file.read(reinterpret_cast<char*>(buffer.begin()),
+                          static_cast<std::streamsize>(sizeof(T)) * buffer.size());
+                filled = static_cast<int>(file.gcount() / static_cast<std::streamsize>(sizeof(T)));
+                position = 0;
+                return filled > 0;
+            });
+        }
+    };
+
+    /// Output of an intermediate pass: a binary run file.
+    class BinaryWriter {
+        std::ofstream file;
+        ExternalSortStats* stats;
+
+    public:
+        BinaryWriter(const std::string& name, ExternalSortStats& statistics)
+            : file(name, std::ios::binary), stats(&statistics) {}
+
+        bool isOpen() const {
+            return static_cast<bool>(file);
+        }
+
+        bool write(const T* values, int count) {
+            return timed(stats->ioMs, [&]() {
+                file.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(sizeof(T)) * count);
+                return static_cast<bool>(file);
+            });
+        }
+    };
+
+    /// Output of the final pass: the FileIO text format.
+    class TextWriter {
+        std::ofstream file;
+        ExternalSortStats* stats;
+
+    public:
+        TextWriter(const std::string& name, long long elements, ExternalSortStats& statistics)
+            : file(name), stats(&statistics) {
+            file << elements << '\n';
+        }
+
+        bool isOpen() const {
+            return static_cast<bool>(file);
+        }
+
+        bool write(const T* values, int count) {
+            return timed(stats->ioMs, [&]() {
+                for (int i = 0; i < count; ++i)
+                    file << values[i] << '\n';
+                return static_cast<bool>(file);
+            });
+        }
+    };
+
+    /// Merges runs [first, last) into writer through a loser tree.
+    template <typename Writer>
+    static bool mergeRuns(const Vektor<std::string>& runs, int first, int last, int budgetElements, Writer&& writer,
+                          ExternalSortStats& stats) {
+        if (!writer.isOpen()) {
+            std::cerr << "Error: Cannot open merge output file" << std::endl;
+            return false;
+        }
+        const int sources = last - first;
+        const int bufferElements = std::max(1, budgetElements / (sources + 1));
+
+        Vektor<RunReader> readers;
+        readers.reserve(sources);
+        LoserTree<T> tree(sources);
+        for (int i = 0; i < sources; ++i) {
+            readers.emplace_back(runs[first + i], bufferElements, stats);
+            if (!readers[i].isOpen()) {
+                std::cerr << "Error: Cannot open run file " << runs[first + i] << std::endl;
+                return false;
+            }
+            T value;
+            if (readers[i].next(value))
+                tree.set(i, value);
+        }
+        tree.build();
+
+        Vektor<T> output(bufferElements);
+        int buffered = 0;
+        bool ok = true;
+        const auto cpuStart = Clock::now();
+        const double ioBefore = stats.ioMs;
+        while (!tree.empty() && ok) {
+            output[buffered++] = tree.winnerKey();
+            T value;
+            if (readers[tree.winner()].next(value))
+                tree.replaceWinner(value);
+            else
+                tree.exhaustWinner();
+            if (buffered == bufferElements) {
+                ok = writer.write(output.begin(), buffered);
+                buffered = 0;
+            }
+        }
+        if (ok && buffered > 0)
+            ok = writer.write(output.begin(), buffered);
+
+        // Reads and writes inside the loop were counted as I/O; the rest of the loop is merge CPU time.
+        const double loopMs = std::chrono::duration<double, std::milli>(Clock::now() - cpuStart).count();
+        stats.cpuMs += std::max(0.0, loopMs - (stats.ioMs - ioBefore));
+        if (!ok)
+            std::cerr << "Error: Cannot write merge output" << std::endl;
+        return ok;
+    }
+};
+
+#endif
@@ -18,6 +18,7 @@ public:
         }
         infile >> size;
         Vektor<T> vector;
+        vector.reserve(size);
         T temp;
         for (int i = 0; i < size; i++) {
             infile >> temp;
@@ -82,6 +83,38 @@ public:
             << '[' << minVal << ',' << maxVal << ']'
             << "\n";
     }
+
+    /**
+     * Appends a summary row of a parallel run: the regular columns followed by the thread count,
+     * the speedup over the single-thread run and the parallel efficiency (speedup / threads).
+     */
+    static void appendSummaryEntry(const std::string &summaryHistoryFile, const std::string &timeStamp, int dataLength,
+        const char *sortingOrder, const char *algorithmName, const char *dataTypeName, int repeatCount, int minTime,
+        int maxTime, double average, double median, T minVal, T maxVal, int threads, double speedup, double efficiency)
+    {
+        std::ofstream ofs(summaryHistoryFile, std::ios::app);
+        if (!ofs) {
+            std::cerr << "Error: Cannot open summary‐history file "
+                      << summaryHistoryFile << std::endl;
+            return;
+        }
+        // timestamp;numberOfElements;SortOrder;SortingAlgorithm;Type;Reps;Min;Max;Avg;Med;Range;Threads;Speedup;Efficiency
+        ofs << timeStamp << ';'
+            << dataLength << ';'
+            << sortingOrder << ';'
+            << algorithmName << ';'
+            << dataTypeName << ';'
+            << repeatCount << ';'
+            << minTime << ';'
+            << maxTime << ';'
+            << average << ';'
+            << median << ';'
+            << '[' << minVal << ',' << maxVal << ']' << ';'
+            << threads << ';'
+            << speedup << ';'
+            << efficiency
+            << "\n";
+    }
 };
 
 #endif
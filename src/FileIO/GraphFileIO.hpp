@@ -17,17 +17,18 @@ public:
 
     /**
    * Reads a graph from a file and creates an instance of the selected graph type.
-   * Performs basic format and value validation.
+   * Performs basic format and value validation; the header's edge count sizes the edge buffer,
+   * and the graph itself is laid out in one pass by GraphBuilder.
    * Time complexity: O(E) for edge reading, O(V + E) for validation.
    */
-    static IGraph* readGraph(const std::string& filename, GraphRepresentingShape type) {
+    static std::optional<AnyGraph> readGraph(const std::string& filename, GraphRepresentingShape type) {
         int declaredEdges = 0;
         int declaredVertices = 0;
 
         std::ifstream file(filename);
 
         if (!isValidGraphFile(file, declaredEdges, declaredVertices)) {
-            return nullptr;
+            return std::nullopt;
         }
 
         file.clear();
@@ -35,18 +36,17 @@ public:
         std::string line;
         std::getline(file, line);
 
-        IGraph* graph = createGraphInstance(type, declaredVertices, declaredEdges);
-        if (!graph) return nullptr;
-
+        Vektor<EdgeTriple> edges;
+        edges.reserve(declaredEdges);
         for (int i = 0; i < declaredEdges; ++i) {
             int from, to, weight;
             file >> from >> to >> weight;
-            if (from != to || to != from) {
-                graph->addEdge(from, to, weight);
+            if (from != to) {
+                edges.push_back({from, to, weight});
             }
         }
 
-        return graph;
+        return createGraphInstance(type, declaredVertices, edges);
     }
 
     /**
@@ -88,7 +88,7 @@ public:
             std::cerr << "[ERROR] Cannot open history file: " << filename << std::endl;
             return;
         }
-        std::string graphTypeStr = (graphType == LIST) ? "LIST" : "MATRIX";
+        std::string graphTypeStr = getShapeName(graphType);
 
         ofs << timeStamp << ';'
             << algorithmName << ';'
@@ -128,7 +128,7 @@ public:
             return;
         }
 
-        std::string graphTypeStr = (graphType == LIST) ? "LIST" : "MATRIX";
+        std::string graphTypeStr = getShapeName(graphType);
 
         ofs << timeStamp << ';'
             << algorithmName << ';'
@@ -145,6 +145,38 @@ public:
         ofs.close();
     }
 
+    /**
+     * Appends one allocation-count row (stage name, graph size, Vektor allocations and bytes, time).
+     */
+    static void appendAllocationEntry(
+        const std::string& filename,
+        const std::string& timeStamp,
+        const std::string& stageName,
+        int vertexCount,
+        int edgeCount,
+        int repetitionNumber,
+        long long allocations,
+        long long allocatedBytes,
+        int timeMs
+    ) {
+        std::ofstream ofs(filename, std::ios::app);
+        if (!ofs) {
+            std::cerr << "[ERROR] Cannot open allocation log file: " << filename << std::endl;
+            return;
+        }
+
+        ofs << timeStamp << ';'
+            << stageName << ';'
+            << vertexCount << ';'
+            << edgeCount << ';'
+            << repetitionNumber << ';'
+            << allocations << ';'
+            << allocatedBytes << ';'
+            << timeMs << '\n';
+
+        ofs.close();
+    }
+
 private:
 
     /**
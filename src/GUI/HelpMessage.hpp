@@ -11,20 +11,32 @@ public:
         "SORTING ALGORITHMS:\n"
         "       FILE INPUT MODE:\n"
         "           ./ProjectPath --file <algorithmFlag> <typeFlag> <inputFile> <outputFile>\n"
-        "               <algorithmFlag> : --is for Insertion Sort, --bi for Binary Insertion Sort, --hs for Heap Sort, --qs for Quick Sort\n"
+        "               <algorithmFlag> : --is for Insertion Sort, --bi for Binary Insertion Sort, --gbi for Galloping Binary Insertion Sort (block moves), --hs for Heap Sort, --bhs for Bottom-Up Heap Sort, --hs4 for 4-Ary Heap Sort, --qs for Quick Sort, --ps for Pattern-Defeating Quick Sort, --q3 for 3-Way Quick Sort, --rs for Radix Sort, --simd for SIMD Quick Sort (AVX2, scalar fallback), --bqs for Block Quick Sort, --ts for Tim Sort, --pqs for Parallel Quick Sort, --pms for Parallel Merge Sort, --ss for Parallel Sample Sort\n"
         "               <typeFlag>      : --i for int, --f for float, --d for double\n"
         "               <inputFile>     : Input file containing the data to be sorted\n"
         "               <outputFile>    : Output file for the sorted data\n\n"
+        "       EXTERNAL SORT MODE:\n"
+        "           ./ProjectPath --externalSort <algorithmFlag> <typeFlag> <inputFile> <outputFile> <memoryMB> <fanIn>\n"
+        "               Sorts files larger than memory: chunks of <memoryMB> are sorted with the chosen algorithm, written\n"
+        "               as sorted runs to temporary files and merged <fanIn> runs at a time; I/O and CPU time are reported separately\n"
+        "               <algorithmFlag> : --is for Insertion Sort, --bi for Binary Insertion Sort, --gbi for Galloping Binary Insertion Sort (block moves), --hs for Heap Sort, --bhs for Bottom-Up Heap Sort, --hs4 for 4-Ary Heap Sort, --qs for Quick Sort, --ps for Pattern-Defeating Quick Sort, --q3 for 3-Way Quick Sort, --rs for Radix Sort, --simd for SIMD Quick Sort (AVX2, scalar fallback), --bqs for Block Quick Sort, --ts for Tim Sort, --pqs for Parallel Quick Sort, --pms for Parallel Merge Sort, --ss for Parallel Sample Sort\n"
+        "               <typeFlag>      : --i for int, --f for float, --d for double\n"
+        "               <inputFile>     : Input file in the same format as in file input mode\n"
+        "               <outputFile>    : Output file for the sorted data\n"
+        "               <memoryMB>      : Memory budget in megabytes for chunks and merge buffers (e.g. 64 or 0.5)\n"
+        "               <fanIn>         : Number of runs merged at once, at least 2\n\n"
         "       BENCHMARK MODE:\n"
         "           ./ProjectPath --benchmark <algorithmFlag> <typeFlag> <size> [minValue maxValue] <outputFile>\n"
-        "               <algorithmFlag> : --is for Insertion Sort, --bi for Binary Insertion Sort, --hs for Heap Sort, --qs for Quick Sort\n"
+        "               <algorithmFlag> : --is for Insertion Sort, --bi for Binary Insertion Sort, --gbi for Galloping Binary Insertion Sort (block moves), --hs for Heap Sort, --bhs for Bottom-Up Heap Sort, --hs4 for 4-Ary Heap Sort, --qs for Quick Sort, --ps for Pattern-Defeating Quick Sort, --q3 for 3-Way Quick Sort, --rs for Radix Sort, --simd for SIMD Quick Sort (AVX2, scalar fallback), --bqs for Block Quick Sort, --ts for Tim Sort, --pqs for Parallel Quick Sort, --pms for Parallel Merge Sort, --ss for Parallel Sample Sort\n"
         "               <typeFlag>      : --i for int, --f for float, --d for double\n"
         "               <size>          : Number of elements to generate\n"
         "               [minValue maxValue] : (Optional) Range for generating random numbers (default: 0 and 1000)\n"
-        "               <outputFile>    : File where benchmark result (sorted output) will be saved\n\n"
+        "               <outputFile>    : File where benchmark result (sorted output) will be saved\n"
+        "               Benchmark and series modes also print branch misses, instructions and cycles\n"
+        "               of each sort when Linux hardware counters (perf_event_open) are available\n\n"
         "       SERIES MODE:\n"
         "           ./ProjectPath --series <algorithmFlag> <typeFlag> <size> <repetitionCount> [minValue maxValue] <outputFile> <individualOutputFlag>\n"
-        "               <algorithmFlag>     : --is for Insertion Sort, --bi for Binary Insertion Sort, --hs for Heap Sort, --qs for Quick Sort\n"
+        "               <algorithmFlag>     : --is for Insertion Sort, --bi for Binary Insertion Sort, --gbi for Galloping Binary Insertion Sort (block moves), --hs for Heap Sort, --bhs for Bottom-Up Heap Sort, --hs4 for 4-Ary Heap Sort, --qs for Quick Sort, --ps for Pattern-Defeating Quick Sort, --q3 for 3-Way Quick Sort, --rs for Radix Sort, --simd for SIMD Quick Sort (AVX2, scalar fallback), --bqs for Block Quick Sort, --ts for Tim Sort, --pqs for Parallel Quick Sort, --pms for Parallel Merge Sort, --ss for Parallel Sample Sort\n"
         "               <typeFlag>          : --i for int, --f for float, --d for double\n"
         "               <size>       : Number of elements to generate for each test run\n"
         "               <repetitionCount>  : Number of test repetitions to run the benchmark\n"
@@ -33,22 +45,43 @@ public:
         "               <individualOutputFlag>   : --t for creating separate folder with .txt files of each repetition sorted data, --f for not creating such folder\n\n"
         "       STUDY1 MODE (VARY SIZES):\n"
         "           ./ProjectPath --study1 <algorithmFlag> <typeFlag> <repeatCount> <individualOutputFlag> <outputFile>\n"
-        "               Runs five benchmarks with sizes {10000,20000,40000,80000,160000} and with random data input order\n"
+        "               Runs benchmarks with sizes {10000,...,160000} and with random data input order;\n"
+        "               all algorithms except --is, --bi and --gbi also run 320000, 640000 and 1280000\n"
+        "               <algorithmFlag>     : One flag or a comma-separated list (e.g. --qs,--q3) to compare algorithms side by side in study modes\n"
         "               <repeatCount>       : Number of repetitions per size\n"
         "               <individualOutputFlag> : --t to save each run’s sorted data files, --f to skip\n\n"
         "       STUDY2 MODE (VARY DISTRIBUTIONS):\n"
         "           ./ProjectPath --study2 <algorithmFlag> <typeFlag> <size> <repeatCount> <individualOutputFlag> <outputFile>\n"
         "               Runs benchmarks on same size but different input orderings:\n"
-        "               random, ascending, descending, 33% sorted, 66% sorted\n\n"
+        "               random, ascending, descending, 33% sorted, 66% sorted, few unique values\n"
+        "               e.g. --qs,--ts shows how much an adaptive sort gains from presorted input\n\n"
         "       STUDY3 MODE (VARY TYPES):\n"
         "           ./ProjectPath --study3 <algorithmFlag> <repeatCount> <individualOutputFlag> <outputFile>\n"
         "               Runs benchmarks on int, float, and double for the same sizes as in study 1 and random data input order\n\n"
+        "       ACCESS POLICY BENCHMARK MODE:\n"
+        "           ./ProjectPath --accessBenchmark <typeFlag> <size> <repetitionCount>\n"
+        "               Sorts the same random data with all four algorithms using checked and unchecked Vektor access\n"
+        "               <typeFlag>          : --i for int, --f for float, --d for double\n\n"
+        "       PERCENTILE BENCHMARK MODE:\n"
+        "           ./ProjectPath --percentileBenchmark <typeFlag> <size> <repetitionCount>\n"
+        "               Computes the 1st, 50th, 90th, 99th and 99.9th percentiles of random data with a full sort, nthElement,\n"
+        "               partial sort of the smallest 1% and top-k of the largest 1%, checks them and records the times\n"
+        "               (e.g. --percentileBenchmark --i 10000000 5)\n"
+        "               <typeFlag>          : --i for int, --f for float, --d for double\n\n"
+        "       PARALLEL SCALING BENCHMARK MODE:\n"
+        "           ./ProjectPath --parallelBenchmark <algorithmFlag> <typeFlag> <size> <repetitionCount>\n"
+        "               Sorts the same random data with 1, 2, 4, ... threads up to --threads N and records time,\n"
+        "               speedup and efficiency per thread count in benchmark_summary_history_<Algorithm>_scaling.txt\n"
+        "               <algorithmFlag>     : --pqs for Parallel Quick Sort, --pms for Parallel Merge Sort, --ss for Parallel Sample Sort\n\n"
+        "       THREAD COUNT:\n"
+        "           --threads N may be added to any sorting mode to run parallel algorithms on N threads\n"
+        "               (default: number of hardware threads)\n\n"
         "GRAPH ALGORITHMS:\n"
         "       FILE INPUT MODE:\n"
         "           ./ProjectPath --gFile <problemFlag> <algorithmFlag> <representationFlag> <inputFile> [outputFile] [sourceVertice] [destinationVertice]\n"
         "               <problemFlag>           : --mst for Minimum Spawning Tree, --tsp for Travelling Salesman Problem\n"
-        "               <algorithmFlag>         : --prim for Prim Algorithm, --krus for Kruskal Algorithm, --dij for Dijkstri Algorithm, --ford for Ford-Bellman Algorithm, --all for All Algorithms of current problem\n"
-        "               <representationFlag>    : --list for List of Neighbors as Graph representation, --matrix for Incydens Matrix as Graph representation, --all for All Accesible representations\n"
+        "               <algorithmFlag>         : --prim for Prim Algorithm, --primheap for heap-based Prim (list only), --krus for Kruskal Algorithm, --dij for Dijkstri Algorithm, --dijdial / --dijradix for Dijkstra with Dial bucket queue (edge weights up to 65536) / radix heap (list only), --ford for Ford-Bellman Algorithm, --all for All Algorithms of current problem\n"
+        "               <representationFlag>    : --list for List of Neighbors as Graph representation, --matrix for Incydens Matrix as Graph representation, --csr for Compressed Sparse Row as Graph representation, --dense for V x V Adjacency Matrix as Graph representation (Prim and Dijkstra only), --all for All Accesible representations\n"
         "               <inputFile>             : Input file containing the graph. First row must contain number of Edges and Vertices\n"
         "               <outputFile>            : Output file for solution and timing\n"
         "               [sourceVertice]         : Edge where TSP problem will start from  \n"
@@ -56,12 +89,24 @@ public:
         "       BENCHMARK MODE:\n"
         "           ./ProjectPath --gBenchmark <problemFlag> <algorithmFlag> <representationFlag> <verticesCount> <density> <repetitionCount> <outputFile>\n"
         "               <problemFlag>           : --mst for Minimum Spawning Tree, --tsp for Travelling Salesman Problem\n"
-        "               <algorithmFlag>         : --prim for Prim Algorithm, --krus for Kruskal Algorithm, --dij for Dijkstri Algorithm, --ford for Ford-Bellman Algorithm, --all for All Algorithms of current problem\n"
-        "               <representationFlag>    : --list for List of Neighbors as Graph representation, --matrix for Incydens Matrix as Graph representation, --all for All Accesible representations\n"
+        "               <algorithmFlag>         : --prim for Prim Algorithm, --primheap for heap-based Prim (list only), --krus for Kruskal Algorithm, --dij for Dijkstri Algorithm, --dijdial / --dijradix for Dijkstra with Dial bucket queue (edge weights up to 65536) / radix heap (list only), --ford for Ford-Bellman Algorithm, --all for All Algorithms of current problem\n"
+        "               <representationFlag>    : --list for List of Neighbors as Graph representation, --matrix for Incydens Matrix as Graph representation, --csr for Compressed Sparse Row as Graph representation, --dense for V x V Adjacency Matrix as Graph representation (Prim and Dijkstra only), --all for All Accesible representations\n"
         "               <verticesCount>         : Number of Vertices (Nodes)\n"
         "               <density>               : Density of edges \n"
         "               <repetitionCount>       : How many times test should be repeated (with graph regen)\n"
         "               <outputFile>            : Output file for solution and timing\n\n"
+        "       ALLOCATION BENCHMARK MODE:\n"
+        "           ./ProjectPath --gAllocBenchmark <verticesCount> <density> <repetitionCount> [outputFile]\n"
+        "               Counts Vektor allocations of random graph generation and of Adjacency List construction (edge by edge and via GraphBuilder)\n"
+        "               [outputFile]            : Allocation log file (default: ./benchmark_allocations.txt)\n\n"
+        "       ADJACENCY CONTAINER BENCHMARK MODE:\n"
+        "           ./ProjectPath --gAdjBenchmark <verticesCount> <density> <repetitionCount> [outputFile]\n"
+        "               Compares allocation traffic, resident footprint and Dijkstra/Ford-Bellman traversal time of Vektor and inline SmallVektor adjacency lists\n"
+        "               [outputFile]            : Result log file (default: ./benchmark_adjacency.txt)\n\n"
+        "       DIJKSTRA QUEUE BENCHMARK MODE:\n"
+        "           ./ProjectPath --gQueueBenchmark <verticesCount> <repetitionCount> <density> [density ...]\n"
+        "               Compares DijkstraList with binary heap, Dial bucket queue and radix heap backends on the same graphs per density\n"
+        "               Results are appended to ./benchmark_dijkstra_queues.txt\n\n"
         "HELP MODE:\n"
         "  ./ProjectPath --help\n"
         "    Displays this help message\n\n"
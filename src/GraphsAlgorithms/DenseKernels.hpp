@@ -0,0 +1,178 @@
+#ifndef DENSE_KERNELS_HPP
+#define DENSE_KERNELS_HPP
+
+#include "../GraphsImpl/GraphDense.hpp"
+#include "../common/SimdSupport.hpp"
+
+/**
+ * Per-row loops of the O(V^2) Prim and Dijkstra on GraphDense, written out with AVX2 intrinsics:
+ * 8 vertices per step, selects instead of branches. Every kernel checks the CPU at runtime and
+ * falls back to a scalar loop with the same result on CPUs without AVX2 and on non-x86 targets.
+ * Rows, keys and flags are raw int arrays; flags hold 0 or 1 and keys use GraphDense::NO_EDGE as infinity.
+ */
+class DenseKernels {
+public:
+    /**
+     * Returns the first vertex with flag 0 and the smallest key below NO_EDGE, or -1 if there is none.
+     * Time complexity: O(V)
+     */
+    static int selectClosestVertex(const int* key, const int* flag, const int vertexQuantity) {
+#ifdef SIMD_X86
+        if (SimdSupport::hasAvx2()) return selectClosestVertexAvx2(key, flag, vertexQuantity);
+#endif
+        return selectClosestVertexScalar(key, flag, vertexQuantity);
+    }
+
+    /**
+     * Dijkstra relaxation of every edge leaving u: distance[v] = min(distance[v], distance[u] + row[v]).
+     * Missing edges hold NO_EDGE, so they never produce a shorter candidate, and with
+     * non-negative weights visited vertices are never improved either.
+     * Time complexity: O(V)
+     */
+    static void relaxRow(const int* row, const int u, int* distance, int* parent, const int vertexQuantity) {
+#ifdef SIMD_X86
+        if (SimdSupport::hasAvx2()) {
+            relaxRowAvx2(row, u, distance, parent, vertexQuantity);
+            return;
+        }
+#endif
+        relaxRowScalar(row, u, distance[u], distance, parent, 0, vertexQuantity);
+    }
+
+    /**
+     * Prim key update: every vertex outside the tree that u reaches with a lighter edge takes that edge.
+     * Time complexity: O(V)
+     */
+    static void updateKeys(const int* row, const int u, int* key, int* parent, const int* inTree,
+                           const int vertexQuantity) {
+#ifdef SIMD_X86
+        if (SimdSupport::hasAvx2()) {
+            updateKeysAvx2(row, u, key, parent, inTree, vertexQuantity);
+            return;
+        }
+#endif
+        updateKeysScalar(row, u, key, parent, inTree, 0, vertexQuantity);
+    }
+
+private:
+    static constexpr int LANES = 8;
+
+    static int selectClosestVertexScalar(const int* key, const int* flag, const int vertexQuantity) {
+        int best = GraphDense::NO_EDGE;
+        for (int v = 0; v < vertexQuantity; ++v) {
+            const int flagMask = -flag[v];
+            const int candidate = (key[v] & ~flagMask) | (GraphDense::NO_EDGE & flagMask);
+            best = candidate < best ? candidate : best;
+        }
+        if (best == GraphDense::NO_EDGE) return -1;
+
+        for (int v = 0; v < vertexQuantity; ++v) {
+            if (!flag[v] && key[v] == best) return v;
+        }
+        return -1;
+    }
+
+    static void relaxRowScalar(const int* row, const int u, const int base, int* distance, int* parent,
+                               const int from, const int to) {
+        for (int v = from; v < to; ++v) {
+            const int candidate = base + row[v];
+            const bool shorter = candidate < distance[v];
+            distance[v] = shorter ? candidate : distance[v];
+            parent[v] = shorter ? u : parent[v];
+        }
+    }
+
+    static void updateKeysScalar(const int* row, const int u, int* key, int* parent, const int* inTree,
+                                 const int from, const int to) {
+        for (int v = from; v < to; ++v) {
+            const int weight = row[v];
+            const int current = key[v];
+            const int currentParent = parent[v];
+            const bool lighter = (inTree[v] == 0) & (weight < current);
+            key[v] = lighter ? weight : current;
+            parent[v] = lighter ? u : currentParent;
+        }
+    }
+
+#ifdef SIMD_X86
+    SIMD_AVX2 static __m256i load(const int* source) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+    }
+
+    SIMD_AVX2 static void store(int* destination, __m256i v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), v);
+    }
+
+    /// Flagged lanes read as NO_EDGE, so they never win the minimum.
+    SIMD_AVX2 static __m256i maskedKeys(const int* key, const int* flag, __m256i infinity) {
+        const __m256i flagged = _mm256_sub_epi32(_mm256_setzero_si256(), load(flag));
+        return _mm256_blendv_epi8(load(key), infinity, flagged);
+    }
+
+    /// Min reduction 8 lanes at a time, then a compare-and-movemask search for the first lane holding it.
+    SIMD_AVX2 static int selectClosestVertexAvx2(const int* key, const int* flag, const int vertexQuantity) {
+        const __m256i infinity = _mm256_set1_epi32(GraphDense::NO_EDGE);
+        const int vectorEnd = vertexQuantity - vertexQuantity % LANES;
+
+        __m256i minimum = infinity;
+        for (int v = 0; v < vectorEnd; v += LANES)
+            minimum = _mm256_min_epi32(minimum, maskedKeys(key + v, flag + v, infinity));
+        __m128i half = _mm_min_epi32(_mm256_castsi256_si128(minimum), _mm256_extracti128_si256(minimum, 1));
+        half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        int best = _mm_cvtsi128_si32(half);
+        for (int v = vectorEnd; v < vertexQuantity; ++v) {
+            if (!flag[v] && key[v] < best) best = key[v];
+        }
+        if (best == GraphDense::NO_EDGE) return -1;
+
+        const __m256i target = _mm256_set1_epi32(best);
+        for (int v = 0; v < vectorEnd; v += LANES) {
+            const __m256i equal = _mm256_cmpeq_epi32(maskedKeys(key + v, flag + v, infinity), target);
+            const int lanes = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+            if (lanes != 0) return v + __builtin_ctz(lanes);
+        }
+        for (int v = vectorEnd; v < vertexQuantity; ++v) {
+            if (!flag[v] && key[v] == best) return v;
+        }
+        return -1;
+    }
+
+    /// distance + NO_EDGE stays below INT_MAX, so the 32-bit add cannot wrap.
+    SIMD_AVX2 static void relaxRowAvx2(const int* row, const int u, int* distance, int* parent,
+                                       const int vertexQuantity) {
+        const int base = distance[u];
+        const __m256i baseVector = _mm256_set1_epi32(base);
+        const __m256i source = _mm256_set1_epi32(u);
+        const int vectorEnd = vertexQuantity - vertexQuantity % LANES;
+
+        for (int v = 0; v < vectorEnd; v += LANES) {
+            const __m256i current = load(distance + v);
+            const __m256i candidate = _mm256_add_epi32(baseVector, load(row + v));
+            const __m256i shorter = _mm256_cmpgt_epi32(current, candidate);
+            store(distance + v, _mm256_min_epi32(current, candidate));
+            store(parent + v, _mm256_blendv_epi8(load(parent + v), source, shorter));
+        }
+        relaxRowScalar(row, u, base, distance, parent, vectorEnd, vertexQuantity);
+    }
+
+    SIMD_AVX2 static void updateKeysAvx2(const int* row, const int u, int* key, int* parent, const int* inTree,
+                                         const int vertexQuantity) {
+        const __m256i source = _mm256_set1_epi32(u);
+        const __m256i zero = _mm256_setzero_si256();
+        const int vectorEnd = vertexQuantity - vertexQuantity % LANES;
+
+        for (int v = 0; v < vectorEnd; v += LANES) {
+            const __m256i weight = load(row + v);
+            const __m256i current = load(key + v);
+            const __m256i outside = _mm256_cmpeq_epi32(load(inTree + v), zero);
+            const __m256i lighter = _mm256_and_si256(outside, _mm256_cmpgt_epi32(current, weight));
+            store(key + v, _mm256_blendv_epi8(current, weight, lighter));
+            store(parent + v, _mm256_blendv_epi8(load(parent + v), source, lighter));
+        }
+        updateKeysScalar(row, u, key, parent, inTree, vectorEnd, vertexQuantity);
+    }
+#endif
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef GRAPH_ALGORITHMS_HPP
+#define GRAPH_ALGORITHMS_HPP
+
+#include "../GraphsImpl/GraphList.hpp"
+#include "../GraphsImpl/GraphMatrix.hpp"
+#include "../GraphsImpl/GraphCSR.hpp"
+#include "../GraphsImpl/GraphDense.hpp"
+#include "MSTProblem/PrimList.hpp"
+#include "MSTProblem/PrimHeapList.hpp"
+#include "MSTProblem/PrimMatrix.hpp"
+#include "MSTProblem/PrimCSR.hpp"
+#include "MSTProblem/PrimDense.hpp"
+#include "MSTProblem/KruskalList.hpp"
+#include "MSTProblem/KruskalMatrix.hpp"
+#include "MSTProblem/KruskalCSR.hpp"
+#include "TSPProblem/DijkstraList.hpp"
+#include "TSPProblem/DijkstraMatrix.hpp"
+#include "TSPProblem/DijkstraCSR.hpp"
+#include "TSPProblem/DijkstraDense.hpp"
+#include "TSPProblem/FordBellmanList.hpp"
+#include "TSPProblem/FordBellmanMatrix.hpp"
+#include "TSPProblem/FordBellmanCSR.hpp"
+
+/**
+ * Maps a graph representation to the algorithm implementations written for it.
+ * void marks an algorithm that has no variant for that representation.
+ */
+template <typename G>
+struct GraphAlgorithms;
+
+template <>
+struct GraphAlgorithms<GraphList> {
+    using Prim = PrimList;
+    using PrimHeap = PrimHeapList;
+    using Kruskal = KruskalList;
+    using Dijkstra = DijkstraList;
+    using DijkstraDial = DialDijkstraList;
+    using DijkstraRadix = RadixDijkstraList;
+    using FordBellman = FordBellmanList;
+};
+
+template <>
+struct GraphAlgorithms<GraphMatrix> {
+    using Prim = PrimMatrix;
+    using PrimHeap = void;
+    using Kruskal = KruskalMatrix;
+    using Dijkstra = DijkstraMatrix;
+    using DijkstraDial = void;
+    using DijkstraRadix = void;
+    using FordBellman = FordBellmanMatrix;
+};
+
+template <>
+struct GraphAlgorithms<GraphCSR> {
+    using Prim = PrimCSR;
+    using PrimHeap = void;
+    using Kruskal = KruskalCSR;
+    using Dijkstra = DijkstraCSR;
+    using DijkstraDial = void;
+    using DijkstraRadix = void;
+    using FordBellman = FordBellmanCSR;
+};
+
+template <>
+struct GraphAlgorithms<GraphDense> {
+    using Prim = PrimDense;
+    using PrimHeap = void;
+    using Kruskal = void;
+    using Dijkstra = DijkstraDense;
+    using DijkstraDial = void;
+    using DijkstraRadix = void;
+    using FordBellman = void;
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef KRUSKAL_CSR_HPP
+#define KRUSKAL_CSR_HPP
+
+#include <iostream>
+
+#include "../../GraphsImpl/GraphCSR.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include "../../common/UnionJoinSet.hpp"
+#include "../../SortAlgorithms/SortAlgorithms.hpp"
+
+class KruskalCSR {
+public:
+    /**
+    * Finds the Minimum Spanning Tree (MST) using Kruskal's algorithm on a graph stored in CSR form.
+    * Parallel and reversed edges are kept: the heavier copy is simply rejected by the union-find check.
+    * Time complexity: O(E + W) with counting sort over the weight range W, otherwise O(E * log E).
+    */
+    static Vektor<EdgeTriple> findMST(const GraphCSR* graph) {
+        return findMSTFromEdges(extractEdges(graph), graph->getVertexCount());
+    }
+
+    /**
+     * Second phase of findMST, after extractEdges: sorts the edges by weight and joins components with union-find.
+     * Time complexity: that of sortEdgesByWeight plus O(E * alpha(V)) for the union-find pass.
+     */
+    static Vektor<EdgeTriple> findMSTFromEdges(Vektor<EdgeTriple> allEdges, const int vertexQuantity) {
+        sortEdgesByWeight(allEdges);
+
+        UnionJoinSet unionJoinSet(vertexQuantity);
+        Vektor<EdgeTriple> mst;
+
+        for (int i = 0; i < allEdges.size() && mst.size() < vertexQuantity - 1; ++i) {
+            auto e = allEdges[i];
+            if (unionJoinSet.find(e.from) != unionJoinSet.find(e.to)) {
+                mst.push_back(e);
+                unionJoinSet.unite(e.from, e.to);
+            }
+        }
+
+        return mst;
+    }
+
+    static std::string calculateMSTWeightAsString(const Vektor<EdgeTriple>& mst) {
+        int total = 0;
+        for (int i = 0; i < mst.size(); ++i) {
+            total += mst[i].weight;
+        }
+        return std::to_string(total);
+    }
+
+    static void displayMST(const Vektor<EdgeTriple>& mst) {
+        int total = 0;
+        std::cout << "MST edges (KruskalCSR):\n";
+        for (int i = 0; i < mst.size(); ++i) {
+            std::cout << mst[i].from << " -- " << mst[i].to << " [weight=" << mst[i].weight << "]\n";
+            total += mst[i].weight;
+        }
+        std::cout << "Total MST weight: " << total << "\n";
+    }
+
+    /**
+     * Copies the outgoing CSR arrays into an edge list in a single pass.
+     * Time complexity: O(V + E)
+     */
+    static Vektor<EdgeTriple> extractEdges(const GraphCSR* graph) {
+        const int vertexQuantity = graph->getVertexCount();
+        const Vektor<int>& offsets = graph->getOffsets();
+        const Vektor<int>& destinations = graph->getDestinations();
+        const Vektor<int>& weights = graph->getWeights();
+
+        Vektor<EdgeTriple> edges;
+        edges.reserve(graph->getEdgeCount());
+        for (int u = 0; u < vertexQuantity; ++u) {
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i)
+                edges.push_back({u, destinations[i], weights[i]});
+        }
+        return edges;
+    }
+
+private:
+    /**
+     * Stable counting sort by weight when the weight range is comparable to the edge count,
+     * quick sort otherwise.
+     */
+    static void sortEdgesByWeight(Vektor<EdgeTriple>& edges) {
+        if (edges.size() < 2) return;
+
+        int minWeight = edges[0].weight;
+        int maxWeight = edges[0].weight;
+        for (int i = 1; i < edges.size(); ++i) {
+            if (edges[i].weight < minWeight) minWeight = edges[i].weight;
+            if (edges[i].weight > maxWeight) maxWeight = edges[i].weight;
+        }
+
+        const long long range = static_cast<long long>(maxWeight) - minWeight + 1;
+        if (range > 4LL * edges.size() + 1024) {
+            SortAlgorithms<EdgeTriple>::quickSort(edges);
+            return;
+        }
+
+        Vektor<int> buckets(static_cast<int>(range) + 1);
+        for (int i = 0; i < edges.size(); ++i)
+            ++buckets[edges[i].weight - minWeight + 1];
+        for (int b = 1; b < buckets.size(); ++b)
+            buckets[b] += buckets[b - 1];
+
+        Vektor<EdgeTriple> sorted(edges.size());
+        for (int i = 0; i < edges.size(); ++i)
+            sorted[buckets[edges[i].weight - minWeight]++] = edges[i];
+        edges = std::move(sorted);
+    }
+};
+
+#endif
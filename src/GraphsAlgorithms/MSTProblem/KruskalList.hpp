@@ -7,13 +7,21 @@
 #include "../../GraphsImpl/GraphList.hpp"
 #include "../../VektorImpl/Vektor.hpp"
 #include "../../common/UnionJoinSet.hpp"
+#include "../../common/EdgeHashSet.hpp"
 #include "../../SortAlgorithms/SortAlgorithms.hpp"
 
 class KruskalList {
 public:
-    static Vektor<EdgeTriple> findMST(const GraphList* graph) {
-        int vertexQuantity = graph->getVertexCount();
-        Vektor<EdgeTriple> allEdges = extractUniqueEdges(graph, vertexQuantity);
+    template <typename Graph>
+    static Vektor<EdgeTriple> findMST(const Graph* graph) {
+        return findMSTFromEdges(extractEdges(graph), graph->getVertexCount());
+    }
+
+    /**
+     * Second phase of findMST, after extractEdges: sorts the edges by weight and joins components with union-find.
+     * Time complexity: that of sortEdgesByWeight plus O(E * alpha(V)) for the union-find pass.
+     */
+    static Vektor<EdgeTriple> findMSTFromEdges(Vektor<EdgeTriple> allEdges, const int vertexQuantity) {
         sortEdgesByWeight(allEdges);
 
         UnionJoinSet unionJoinSet(vertexQuantity);
@@ -48,10 +56,15 @@ public:
         std::cout << "Total MST weight: " << total << "\n";
     }
 
-private:
-    static Vektor<EdgeTriple> extractUniqueEdges(const GraphList* graph, int vertexQuantity) {
+    /**
+     * Collects every undirected edge once; each appears in both endpoints' neighbor lists.
+     * Time complexity: O(V + E) expected.
+     */
+    template <typename Graph>
+    static Vektor<EdgeTriple> extractEdges(const Graph* graph) {
+        const int vertexQuantity = graph->getVertexCount();
         Vektor<EdgeTriple> edges;
-        Vektor<std::pair<int, int>> seenEdges;
+        EdgeHashSet seenEdges(graph->getEdgeCount());
 
         for (int u = 0; u < vertexQuantity; ++u) {
             const auto& neighbors = graph->getNeighbors(u);
@@ -59,27 +72,15 @@ private:
                 int v = neighbors[i].dest;
                 const int w = neighbors[i].weight;
 
-                int a = std::min(u, v);
-                int b = std::max(u, v);
-
-                bool exists = false;
-                for (int j = 0; j < seenEdges.size(); ++j) {
-                    if (seenEdges[j].first == a && seenEdges[j].second == b) {
-                        exists = true;
-                        break;
-                    }
-                }
-
-                if (!exists) {
-                    edges.push_back({a, b, w});
-                    seenEdges.push_back({a, b});
-                }
+                if (seenEdges.insert(u, v))
+                    edges.push_back({std::min(u, v), std::max(u, v), w});
             }
         }
 
         return edges;
     }
 
+private:
     static void sortEdgesByWeight(Vektor<EdgeTriple>& edges) {
         SortAlgorithms<EdgeTriple>::quickSort(edges);
     }
@@ -7,13 +7,20 @@
 #include "../../GraphsImpl/GraphMatrix.hpp"
 #include "../../VektorImpl/Vektor.hpp"
 #include "../../common/UnionJoinSet.hpp"
+#include "../../common/EdgeHashSet.hpp"
 #include "../../SortAlgorithms/SortAlgorithms.hpp"
 
 class KruskalMatrix {
 public:
     static Vektor<EdgeTriple> findMST(const GraphMatrix* graph) {
-        const int vertexQuantity = graph->getVertexCount();
-        Vektor<EdgeTriple> allEdges = extractAllEdges(graph);
+        return findMSTFromEdges(extractEdges(graph), graph->getVertexCount());
+    }
+
+    /**
+     * Second phase of findMST, after extractEdges: sorts the edges by weight and joins components with union-find.
+     * Time complexity: that of sortEdgesByWeight plus O(E * alpha(V)) for the union-find pass.
+     */
+    static Vektor<EdgeTriple> findMSTFromEdges(Vektor<EdgeTriple> allEdges, const int vertexQuantity) {
         sortEdgesByWeight(allEdges);
 
         UnionJoinSet unionJoinSet(vertexQuantity);
@@ -48,38 +55,28 @@ public:
         std::cout << "Total MST weight: " << total << "\n";
     }
 
-private:
-    static Vektor<EdgeTriple> extractAllEdges(const GraphMatrix* graph) {
+    /**
+     * Collects every undirected edge once from the incidence columns.
+     * Time complexity: O(E) expected.
+     */
+    static Vektor<EdgeTriple> extractEdges(const GraphMatrix* graph) {
         const int edgeQuantity = graph->getEdgeCount();
         Vektor<EdgeTriple> edges;
-        Vektor<std::pair<int, int>> seenPairs;
+        EdgeHashSet seenPairs(edgeQuantity);
 
         for (int i = 0; i < edgeQuantity; ++i) {
             int u = graph->getFrom(i);
             int v = graph->getDest(i);
             int w = graph->getWeight(i);
 
-            int a = std::min(u, v);
-            int b = std::max(u, v);
-
-            bool exists = false;
-            for (int j = 0; j < seenPairs.size(); ++j) {
-                if (seenPairs[j].first == a && seenPairs[j].second == b) {
-                    exists = true;
-                    break;
-                }
-            }
-
-            if (!exists) {
-                edges.push_back({a, b, w});
-                seenPairs.push_back({a, b});
-            }
+            if (seenPairs.insert(u, v))
+                edges.push_back({std::min(u, v), std::max(u, v), w});
         }
 
         return edges;
     }
 
-
+private:
     static void sortEdgesByWeight(Vektor<EdgeTriple>& edges) {
         SortAlgorithms<EdgeTriple>::quickSort(edges);
     }
@@ -0,0 +1,102 @@
+#ifndef PRIM_CSR_HPP
+#define PRIM_CSR_HPP
+
+#include "../../GraphsImpl/GraphCSR.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include "../../HeapImpl/MinHeap.hpp"
+#include <iostream>
+
+class PrimCSR {
+public:
+    /**
+    * Finds the Minimum Spanning Tree (MST) using Prim's algorithm on a graph stored in CSR form.
+    * The graph is treated as undirected: both outgoing and incoming edge arrays of a vertex are scanned.
+    * Time complexity: O(E * log E) using a lazy priority queue.
+    */
+    static Vektor<EdgeTriple> findMST(const GraphCSR* graph) {
+        const int vertexQuantity = graph->getVertexCount();
+        Vektor<EdgeTriple> mst;
+        if (vertexQuantity == 0) return mst;
+        mst.reserve(vertexQuantity - 1);
+
+        Vektor<bool> inMST;
+        inMST.append_n(vertexQuantity, false);
+        MinHeap<Candidate> candidates;
+
+        inMST[0] = true;
+        pushCandidates(graph, 0, inMST, candidates);
+
+        while (mst.size() < vertexQuantity - 1 && !candidates.empty()) {
+            const Candidate best = candidates.top();
+            candidates.pop();
+            if (inMST[best.to]) continue;
+
+            mst.push_back({best.from, best.to, best.weight});
+            inMST[best.to] = true;
+            pushCandidates(graph, best.to, inMST, candidates);
+        }
+
+        if (mst.size() < vertexQuantity - 1)
+            std::cerr << "[PRIM] Nie znaleziono kolejnej krawędzi — graf nie jest spójny?\n";
+
+        return mst;
+    }
+
+    static std::string calculateMSTWeightAsString(const Vektor<EdgeTriple>& mst) {
+        int totalWeight = 0;
+        for (int i = 0; i < mst.size(); ++i) {
+            totalWeight += mst[i].weight;
+        }
+        return std::to_string(totalWeight);
+    }
+
+    /**
+    * Displays the MST edges and total weight.
+    */
+    static void displayMST(const Vektor<EdgeTriple>& mst) {
+        int total = 0;
+        std::cout << "MST edges (PrimCSR):\n";
+        for (int i = 0; i < mst.size(); ++i) {
+            std::cout << mst[i].from << " -- " << mst[i].to << " [weight=" << mst[i].weight << "]\n";
+            total += mst[i].weight;
+        }
+        std::cout << "Total MST weight: " << total << "\n";
+    }
+
+private:
+    /// Edge leaving the tree, ordered by weight for the heap.
+    struct Candidate {
+        int weight;
+        int from;
+        int to;
+
+        bool operator<(const Candidate& other) const {
+            return weight < other.weight;
+        }
+    };
+
+    /**
+     * Pushes every edge between u and a vertex outside the tree, in either direction.
+     * Time complexity: O(deg(u) * log E)
+     */
+    static void pushCandidates(const GraphCSR* graph, int u, const Vektor<bool>& inMST, MinHeap<Candidate>& candidates) {
+        const Vektor<int>& offsets = graph->getOffsets();
+        const Vektor<int>& destinations = graph->getDestinations();
+        const Vektor<int>& weights = graph->getWeights();
+        for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+            if (!inMST[destinations[i]])
+                candidates.push({weights[i], u, destinations[i]});
+        }
+
+        const Vektor<int>& inOffsets = graph->getInOffsets();
+        const Vektor<int>& sources = graph->getSources();
+        const Vektor<int>& inWeights = graph->getInWeights();
+        for (int i = inOffsets[u]; i < inOffsets[u + 1]; ++i) {
+            if (!inMST[sources[i]])
+                candidates.push({inWeights[i], u, sources[i]});
+        }
+    }
+};
+
+#endif
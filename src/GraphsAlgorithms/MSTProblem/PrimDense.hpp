@@ -0,0 +1,72 @@
+#ifndef PRIM_DENSE_HPP
+#define PRIM_DENSE_HPP
+
+#include "../../GraphsImpl/GraphDense.hpp"
+#include "../DenseKernels.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include <iostream>
+
+class PrimDense {
+public:
+    /**
+    * Finds the Minimum Spanning Tree (MST) using Prim's algorithm on a graph stored in a V x V adjacency matrix.
+    * Uses the symmetric (undirected) rows; the closest-vertex scan and the key update run as AVX2 kernels
+    * (see DenseKernels).
+    * Time complexity: O(V^2)
+    */
+    static Vektor<EdgeTriple> findMST(const GraphDense* graph) {
+        const int vertexQuantity = graph->getVertexCount();
+        Vektor<EdgeTriple> mst;
+        if (vertexQuantity == 0) return mst;
+        mst.reserve(vertexQuantity - 1);
+
+        Vektor<int> keys;
+        Vektor<int> parents;
+        Vektor<int> inMST;
+        keys.append_n(vertexQuantity, GraphDense::NO_EDGE);
+        parents.append_n(vertexQuantity, -1);
+        inMST.append_n(vertexQuantity, 0);
+        keys[0] = 0;
+
+        int* key = keys.begin();
+        int* parent = parents.begin();
+        int* inTree = inMST.begin();
+
+        for (int i = 0; i < vertexQuantity; ++i) {
+            const int u = DenseKernels::selectClosestVertex(key, inTree, vertexQuantity);
+            if (u == -1) {
+                std::cerr << "[PRIM] Nie znaleziono kolejnej krawędzi — graf nie jest spójny?\n";
+                break;
+            }
+            inTree[u] = 1;
+            if (parent[u] != -1) mst.push_back({parent[u], u, key[u]});
+            DenseKernels::updateKeys(graph->getSymmetricRow(u), u, key, parent, inTree, vertexQuantity);
+        }
+
+        return mst;
+    }
+
+    static std::string calculateMSTWeightAsString(const Vektor<EdgeTriple>& mst) {
+        int totalWeight = 0;
+        for (int i = 0; i < mst.size(); ++i) {
+            totalWeight += mst[i].weight;
+        }
+        return std::to_string(totalWeight);
+    }
+
+    /**
+    * Displays the MST edges and total weight.
+    */
+    static void displayMST(const Vektor<EdgeTriple>& mst) {
+        int total = 0;
+        std::cout << "MST edges (PrimDense):\n";
+        for (int i = 0; i < mst.size(); ++i) {
+            std::cout << mst[i].from << " -- " << mst[i].to << " [weight=" << mst[i].weight << "]\n";
+            total += mst[i].weight;
+        }
+        std::cout << "Total MST weight: " << total << "\n";
+    }
+};
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef PRIM_HEAP_LIST_HPP
+#define PRIM_HEAP_LIST_HPP
+
+#include "../../GraphsImpl/GraphList.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include "../../HeapImpl/IndexedMinHeap.hpp"
+#include <iostream>
+#include <limits>
+
+class PrimHeapList {
+public:
+    /**
+     * Finds the Minimum Spanning Tree (MST) using Prim's algorithm with an indexed 4-ary heap on a graph
+     * represented as an adjacency list (GraphList or SmallGraphList).
+     * Every vertex outside the tree is queued once, keyed by its cheapest known edge into the tree,
+     * and that key is lowered in place when a cheaper edge appears.
+     * Time complexity: O((V + E) * log V)
+     */
+    template <typename Graph>
+    static Vektor<EdgeTriple> findMST(const Graph* graph) {
+        const int vertexQuantity = graph->getVertexCount();
+        Vektor<EdgeTriple> mst;
+        if (vertexQuantity == 0) return mst;
+
+        const UndirectedAdjacency adjacency = buildUndirectedAdjacency(graph);
+        Vektor<bool> inMST;
+        inMST.append_n(vertexQuantity, false);
+        Vektor<int> parent;
+        parent.append_n(vertexQuantity, -1);
+        IndexedMinHeap<int> heap(vertexQuantity);
+        mst.reserve(vertexQuantity - 1);
+        heap.push(0, 0);
+
+        while (!heap.empty()) {
+            const int weight = heap.topKey();
+            const int u = heap.pop();
+            inMST[u] = true;
+            if (parent[u] != -1)
+                mst.push_back({parent[u], u, weight});
+
+            for (int i = adjacency.offsets[u]; i < adjacency.offsets[u + 1]; ++i) {
+                const int v = adjacency.targets[i];
+                if (!inMST[v] && heap.pushOrDecrease(v, adjacency.weights[i]))
+                    parent[v] = u;
+            }
+        }
+
+        if (mst.size() < vertexQuantity - 1)
+            std::cerr << "[PRIM] Nie znaleziono kolejnej krawędzi — graf nie jest spójny?\n";
+        return mst;
+    }
+
+    static std::string calculateMSTWeightAsString(const Vektor<EdgeTriple>& mst) {
+        int totalWeight = 0;
+        for (int i = 0; i < mst.size(); ++i) {
+            totalWeight += mst[i].weight;
+        }
+        return std::to_string(totalWeight);
+    }
+
+    /**
+    * Displays the MST edges and total weight.
+    */
+    static void displayMST(const Vektor<EdgeTriple>& mst) {
+        int total = 0;
+        std::cout << "MST edges (PrimHeapList):\n";
+        for (int i = 0; i < mst.size(); ++i) {
+            std::cout << mst[i].from << " -- " << mst[i].to << " [weight=" << mst[i].weight << "]\n";
+            total += mst[i].weight;
+        }
+        std::cout << "Total MST weight: " << total << "\n";
+    }
+
+private:
+    /**
+     * Both directions of every stored edge in CSR form: the neighbours of u are targets/weights[offsets[u], offsets[u + 1]).
+     */
+    struct UndirectedAdjacency {
+        Vektor<int> offsets;
+        Vektor<int> targets;
+        Vektor<int> weights;
+    };
+
+    /**
+     * The list stores an edge only under its source vertex, so incoming edges are gathered here once
+     * instead of being searched for in every other vertex's list.
+     * Time complexity: O(V + E)
+     */
+    template <typename Graph>
+    static UndirectedAdjacency buildUndirectedAdjacency(const Graph* graph) {
+        const int vertexQuantity = graph->getVertexCount();
+        UndirectedAdjacency adjacency;
+        adjacency.offsets.append_n(vertexQuantity + 1, 0);
+
+        for (int u = 0; u < vertexQuantity; ++u) {
+            const auto& neighbors = graph->getNeighbors(u);
+            adjacency.offsets[u + 1] += neighbors.size();
+            for (int i = 0; i < neighbors.size(); ++i)
+                ++adjacency.offsets[neighbors[i].dest + 1];
+        }
+        for (int u = 0; u < vertexQuantity; ++u)
+            adjacency.offsets[u + 1] += adjacency.offsets[u];
+
+        const int slots = adjacency.offsets[vertexQuantity];
+        adjacency.targets.append_n(slots, 0);
+        adjacency.weights.append_n(slots, 0);
+        Vektor<int> next;
+        next.reserve(vertexQuantity);
+        next.insertEnd(adjacency.offsets.begin(), adjacency.offsets.begin() + vertexQuantity);
+
+        for (int u = 0; u < vertexQuantity; ++u) {
+            const auto& neighbors = graph->getNeighbors(u);
+            for (int i = 0; i < neighbors.size(); ++i) {
+                const int v = neighbors[i].dest;
+                const int weight = neighbors[i].weight;
+                adjacency.targets[next[u]] = v;
+                adjacency.weights[next[u]++] = weight;
+                adjacency.targets[next[v]] = u;
+                adjacency.weights[next[v]++] = weight;
+            }
+        }
+        return adjacency;
+    }
+};
+
+#endif
@@ -13,7 +13,8 @@ public:
     * Finds the Minimum Spanning Tree (MST) using Prim's algorithm on a graph represented as an adjacency list.
     * Time complexity: O(V^2) without priority queue.
     */
-    static Vektor<EdgeTriple> findMST(const GraphList* graph) {
+    template <typename Graph>
+    static Vektor<EdgeTriple> findMST(const Graph* graph) {
         const int vertexQuantity = graph->getVertexCount();
 
         Vektor<bool> inMST = initializeMSTFlags(vertexQuantity);
@@ -62,8 +63,7 @@ private:
      */
     static Vektor<bool> initializeMSTFlags(const int vertexQuantity) {
         Vektor<bool> inMST;
-        for (int i = 0; i < vertexQuantity; ++i)
-            inMST.push_back(false);
+        inMST.append_n(vertexQuantity, false);
         return inMST;
     }
 
@@ -72,16 +72,15 @@ private:
      * Works by checking both (u,v) and (v,u) since graph is undirected.
      * Time complexity: O(V^2)
      */
-    static EdgeTriple selectMinimumEdge(const GraphList* graph, const Vektor<bool>& inMST, const int vertexQuantity) {
+    template <typename Graph>
+    static EdgeTriple selectMinimumEdge(const Graph* graph, const Vektor<bool>& inMST, const int vertexQuantity) {
         int minWeight = std::numeric_limits<int>::max();
         EdgeTriple bestEdge = {-1, -1, -1};
 
-        Vektor<std::pair<int, int>> seenPairs;
-
         for (int u = 0; u < vertexQuantity; ++u) {
             if (!inMST[u]) continue;
 
-            const Vektor<Edge>& neighbors = graph->getNeighbors(u);
+            const auto& neighbors = graph->getNeighbors(u);
             for (int i = 0; i < neighbors.size(); ++i) {
                 int v = neighbors[i].dest;
                 int weight = neighbors[i].weight;
@@ -96,7 +95,7 @@ private:
             for (int v = 0; v < vertexQuantity; ++v) {
                 if (v == u || inMST[v]) continue;
 
-                const Vektor<Edge>& incoming = graph->getNeighbors(v);
+                const auto& incoming = graph->getNeighbors(v);
                 for (int j = 0; j < incoming.size(); ++j) {
                     if (incoming[j].dest == u) {
                         int weight = incoming[j].weight;
@@ -66,8 +66,7 @@ private:
     */
     static Vektor<bool> initializeMSTFlags(const int vertexQuantity) {
         Vektor<bool> inMST;
-        for (int i = 0; i < vertexQuantity; ++i)
-            inMST.push_back(false);
+        inMST.append_n(vertexQuantity, false);
         return inMST;
     }
 
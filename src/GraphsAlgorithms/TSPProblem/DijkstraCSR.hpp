@@ -0,0 +1,110 @@
+#ifndef DIJKSTRA_CSR_HPP
+#define DIJKSTRA_CSR_HPP
+
+#include "../../GraphsImpl/GraphCSR.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include "../../HeapImpl/MinHeap.hpp"
+#include <limits>
+#include <iostream>
+
+class DijkstraCSR {
+public:
+    /**
+     * Computes shortest paths from the source using Dijkstra's algorithm
+     * for a directed graph stored in Compressed Sparse Row form.
+     * Edge scans walk contiguous destination/weight arrays.
+     * Time complexity: O((V + E) * log V) using a priority queue.
+     */
+    static Vektor<EdgeTriple> findShortestPaths(const GraphCSR* graph, int source = 0, int destination = -1) {
+        const int vertexQuantity = graph->getVertexCount();
+        const int* offsets = graph->getOffsets().begin();
+        const int* destinations = graph->getDestinations().begin();
+        const int* weights = graph->getWeights().begin();
+
+        Vektor<int> distances;
+        Vektor<int> previous;
+        distances.append_n(vertexQuantity, std::numeric_limits<int>::max());
+        previous.append_n(vertexQuantity, -1);
+        MinHeap<std::pair<int, int>> minHeap; // (distance, vertex)
+        distances[source] = 0;
+        minHeap.push({0, source});
+
+        while (!minHeap.empty()) {
+            const auto [currentDistance, currentVertex] = minHeap.top();
+            minHeap.pop();
+
+            if (currentDistance > distances[currentVertex]) continue;
+
+            for (int i = offsets[currentVertex]; i < offsets[currentVertex + 1]; ++i) {
+                const int neighbor = destinations[i];
+                const int candidate = currentDistance + weights[i];
+                if (candidate < distances[neighbor]) {
+                    distances[neighbor] = candidate;
+                    previous[neighbor] = currentVertex;
+                    minHeap.push({candidate, neighbor});
+                }
+            }
+        }
+        if (destination != -1)
+            return reconstructSinglePath(previous, distances, source, destination);
+
+        return reconstructPaths(previous, distances, source);
+    }
+
+    static std::string calculatePathWeightAsString(const Vektor<EdgeTriple>& paths, bool destination=false) {
+        if (paths.size() == 0) return "0";
+
+        int min = std::numeric_limits<int>::max();
+        int max = std::numeric_limits<int>::min();
+
+        for (int i = 0; i < paths.size(); ++i) {
+            if (paths[i].weight < min) min = paths[i].weight;
+            if (paths[i].weight > max) max = paths[i].weight;
+        }
+
+        if (min == max || destination) return std::to_string(max);
+        return "[" + std::to_string(min) + " - " + std::to_string(max) + "]";
+    }
+
+    /**
+     * Displays all shortest paths from the given source vertex.
+     */
+    static void displayShortestPaths(const Vektor<EdgeTriple>& paths, int source) {
+        int total = 0;
+        std::cout << "Dijkstra (CSR) shortest paths from source " << source << ":\n";
+        for (int i = paths.size() - 1; i >= 0; --i) {
+            const auto&[from, to, weight] = paths[i];
+            std::cout << from << " -> " << to << " [weight=" << weight << "]\n";
+            total += weight;
+        }
+        std::cout << "Total Path weight: " << total << "\n";
+    }
+
+private:
+    /**
+     * Reconstructs a vector of EdgeTriple from parent and distance arrays.
+     */
+    static Vektor<EdgeTriple> reconstructPaths(const Vektor<int>& parents, const Vektor<int>& distances, int source) {
+        Vektor<EdgeTriple> result;
+        for (int v = 0; v < parents.size(); ++v) {
+            if (v != source && parents[v] != -1) {
+                result.push_back({parents[v], v, distances[v]});
+            }
+        }
+        return result;
+    }
+
+    static Vektor<EdgeTriple> reconstructSinglePath(const Vektor<int>& parents, const Vektor<int>& distances, int source, int dest) {
+        Vektor<EdgeTriple> result;
+        if (distances[dest] == std::numeric_limits<int>::max()) return result;
+        int current = dest;
+        while (current != source && parents[current] != -1) {
+            result.push_back({parents[current], current, distances[current]});
+            current = parents[current];
+        }
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef DIJKSTRA_DENSE_HPP
+#define DIJKSTRA_DENSE_HPP
+
+#include <limits>
+#include <iostream>
+
+#include "../../VektorImpl/Vektor.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../GraphsImpl/GraphDense.hpp"
+#include "../DenseKernels.hpp"
+
+class DijkstraDense {
+public:
+    /**
+     * Computes shortest paths from the source using Dijkstra's algorithm
+     * on a directed graph stored in a V x V adjacency matrix.
+     * The closest-vertex scan and the row relaxation run as AVX2 kernels (see DenseKernels).
+     * Time complexity: O(V^2)
+     */
+    static Vektor<EdgeTriple> findShortestPaths(const GraphDense* graph, int source = 0, int destination = -1) {
+        const int vertexQuantity = graph->getVertexCount();
+
+        Vektor<int> distances;
+        Vektor<int> previous;
+        Vektor<int> visited;
+        distances.append_n(vertexQuantity, GraphDense::NO_EDGE);
+        previous.append_n(vertexQuantity, -1);
+        visited.append_n(vertexQuantity, 0);
+        distances[source] = 0;
+
+        int* distance = distances.begin();
+        int* parent = previous.begin();
+        int* done = visited.begin();
+
+        for (int i = 0; i < vertexQuantity; ++i) {
+            const int currentVertex = DenseKernels::selectClosestVertex(distance, done, vertexQuantity);
+            if (currentVertex == -1) break;
+            done[currentVertex] = 1;
+            DenseKernels::relaxRow(graph->getRow(currentVertex), currentVertex, distance, parent, vertexQuantity);
+        }
+
+        if (destination != -1)
+            return reconstructSinglePath(previous, distances, source, destination);
+
+        return reconstructPaths(previous, distances, source);
+    }
+
+    static std::string calculatePathWeightAsString(const Vektor<EdgeTriple>& paths, bool destination=false) {
+        if (paths.size() == 0) return "0";
+
+        int min = std::numeric_limits<int>::max();
+        int max = std::numeric_limits<int>::min();
+
+        for (int i = 0; i < paths.size(); ++i) {
+            if (paths[i].weight < min) min = paths[i].weight;
+            if (paths[i].weight > max) max = paths[i].weight;
+        }
+
+        if (min == max || destination) return std::to_string(max);
+        return "[" + std::to_string(min) + " - " + std::to_string(max) + "]";
+    }
+
+    static void displayShortestPaths(const Vektor<EdgeTriple>& paths, int source) {
+        int total = 0;
+        std::cout << "Dijkstra (Dense) shortest paths from source " << source << ":\n";
+        for (int i = paths.size() - 1; i >= 0; --i) {
+            const auto&[from, to, weight] = paths[i];
+            std::cout << from << " -> " << to << " [weight=" << weight << "]\n";
+            total += weight;
+        }
+        std::cout << "Total Path weight: " << total << "\n";
+    }
+
+private:
+    static Vektor<EdgeTriple> reconstructPaths(const Vektor<int>& parents, const Vektor<int>& distances, int source) {
+        Vektor<EdgeTriple> result;
+        for (int v = 0; v < parents.size(); ++v) {
+            if (v != source && parents[v] != -1) {
+                result.push_back({parents[v], v, distances[v]});
+            }
+        }
+        return result;
+    }
+
+    static Vektor<EdgeTriple> reconstructSinglePath(const Vektor<int>& parents, const Vektor<int>& distances, int source, int dest) {
+        Vektor<EdgeTriple> result;
+        if (distances[dest] == GraphDense::NO_EDGE) return result;
+        int current = dest;
+        while (current != source && parents[current] != -1) {
+            result.push_back({parents[current], current, distances[current]});
+            current = parents[current];
+        }
+        return result;
+    }
+};
+
+#endif
@@ -5,23 +5,37 @@
 #include "../../common/EdgeTriple.hpp"
 #include "../../VektorImpl/Vektor.hpp"
 #include <limits>
+#include <optional>
 #include <queue>
 #include <iostream>
+#include <type_traits>
 
 #include "../../HeapImpl/MinHeap.hpp"
-
-class DijkstraList {
+#include "../../HeapImpl/BucketQueue.hpp"
+#include "../../HeapImpl/RadixHeap.hpp"
+
+/**
+ * Dijkstra on an adjacency list, parameterized by the priority queue of (distance, vertex) pairs.
+ * Queue is MinHeap (any non-negative weights) or a monotone integer queue (BucketQueue, RadixHeap) that
+ * exploits the small integer weights of generated graphs; see the aliases at the end of the file.
+ */
+template <typename Queue>
+class BasicDijkstraList {
 public:
     /**
      * Computes shortest paths from the source using Dijkstra's algorithm
-     * for a directed graph represented as an adjacency list.
-     * Time complexity: O((V + E) * log V) using a priority queue.
+     * for a directed graph represented as an adjacency list (GraphList or SmallGraphList).
+     * Time complexity: O((V + E) * log V) with MinHeap, O(V * C + E) with BucketQueue and
+     * O(E + V * log C) with RadixHeap, C being the largest edge weight.
      */
-    static Vektor<EdgeTriple> findShortestPaths(const GraphList* graph, int source = 0, int destination = -1) {
+    template <typename Graph>
+    static Vektor<EdgeTriple> findShortestPaths(const Graph* graph, int source = 0, int destination = -1) {
         const int vertexQuantity = graph->getVertexCount();
         Vektor<int> distances = initializeTSPDistances(vertexQuantity);
         Vektor<int> previous = initializeTSPPreviousParents(vertexQuantity);
-        MinHeap<std::pair<int, int>> minHeap; // (distance, vertex)
+        std::optional<Queue> queue = makeQueue(graph);
+        if (!queue) return {};
+        Queue& minHeap = *queue; // (distance, vertex)
         distances[source] = 0;
         minHeap.push({0, source});
 
@@ -34,12 +48,20 @@ public:
 
             if (currentDistance > distances[currentVertex]) continue;
 
-            const Vektor<Edge>& neighbors = graph->getNeighbors(currentVertex);
+            const auto& neighbors = graph->getNeighbors(currentVertex);
             for (int i = 0; i < neighbors.size(); ++i) {
                 int neighbor = neighbors[i].dest;
                 int weight = neighbors[i].weight;
 
                 if (distances[currentVertex] + weight < distances[neighbor]) {
+                    // Only an improving edge reaches the queue, so non-improving negative edges are harmless.
+                    if constexpr (isMonotoneQueue()) {
+                        if (weight < 0) {
+                            std::cerr << "[ERROR] Dijkstra with " << Queue::NAME
+                                      << " requires non-negative edge weights" << std::endl;
+                            return {};
+                        }
+                    }
                     distances[neighbor] = distances[currentVertex] + weight;
                     previous[neighbor] = currentVertex;
                     minHeap.push({distances[neighbor], neighbor});
@@ -72,7 +94,10 @@ public:
      */
     static void displayShortestPaths(const Vektor<EdgeTriple>& paths, int source) {
         int total = 0;
-        std::cout << "Dijkstra (List) shortest paths from source " << source << ":\n";
+        if constexpr (isMonotoneQueue())
+            std::cout << "Dijkstra (List, " << Queue::NAME << ") shortest paths from source " << source << ":\n";
+        else
+            std::cout << "Dijkstra (List) shortest paths from source " << source << ":\n";
         for (int i = paths.size() - 1; i >= 0; --i) {
             const auto&[from, to, weight] = paths[i];
             std::cout << from << " -> " << to << " [weight=" << weight << "]\n";
@@ -83,17 +108,56 @@ public:
 
 private:
 
+    /// Monotone queues name themselves and cannot take a key below the last one popped; MinHeap can.
+    static constexpr bool isMonotoneQueue() {
+        return requires { Queue::NAME; };
+    }
+
+    /**
+     * BucketQueue is sized by the largest edge weight, which costs an extra pass over the edges.
+     * Returns nothing if that weight needs more buckets than BucketQueue::MAX_KEY_GAP allows.
+     */
+    template <typename Graph>
+    static std::optional<Queue> makeQueue(const Graph* graph) {
+        if constexpr (std::is_constructible_v<Queue, int>) {
+            const int maxWeight = maxEdgeWeight(graph);
+            if (maxWeight > Queue::MAX_KEY_GAP) {
+                std::cerr << "[ERROR] Dijkstra with " << Queue::NAME << " supports edge weights up to "
+                          << Queue::MAX_KEY_GAP << ", the graph has " << maxWeight << "; use --dij or --dijradix"
+                          << std::endl;
+                return std::nullopt;
+            }
+            return Queue(maxWeight);
+        } else {
+            return Queue();
+        }
+    }
+
+    /**
+     * Returns the largest edge weight, 0 for a graph without edges.
+     * Time complexity: O(V + E)
+     */
+    template <typename Graph>
+    static int maxEdgeWeight(const Graph* graph) {
+        int maxWeight = 0;
+        for (int u = 0; u < graph->getVertexCount(); ++u) {
+            const auto& neighbors = graph->getNeighbors(u);
+            for (int i = 0; i < neighbors.size(); ++i) {
+                if (neighbors[i].weight > maxWeight) maxWeight = neighbors[i].weight;
+            }
+        }
+        return maxWeight;
+    }
+
     static Vektor<int> initializeTSPDistances(const int vertexQuantity) {
         Vektor<int> distances;
-        for (int i = 0; i < vertexQuantity; ++i)
-            distances.push_back(std::numeric_limits<int>::max());
+        distances.append_n(vertexQuantity, std::numeric_limits<int>::max());
         return distances;
     }
 
     static Vektor<int> initializeTSPPreviousParents(const int vertexQuantity) {
         Vektor<int> previous;
-        for (int i = 0; i < vertexQuantity; ++i)
-            previous.push_back(-1);
+        previous.append_n(vertexQuantity, -1);
         return previous;
     }
 
@@ -122,4 +186,13 @@ private:
     }
 };
 
+/// Binary heap with lazy deletion, the general-purpose default.
+using DijkstraList = BasicDijkstraList<MinHeap<std::pair<int, int>>>;
+
+/// Dial's algorithm: circular buckets over the largest edge weight.
+using DialDijkstraList = BasicDijkstraList<BucketQueue>;
+
+/// Radix heap keyed by the bit width of the distance difference.
+using RadixDijkstraList = BasicDijkstraList<RadixHeap>;
+
 #endif
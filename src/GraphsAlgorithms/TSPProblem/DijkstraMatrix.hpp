@@ -13,7 +13,7 @@ public:
     /**
      * Computes shortest paths from a source vertex using Dijkstra's algorithm
      * on a directed graph stored in an incidence matrix.
-     * Time complexity: O(V^2)
+     * Time complexity: O(V * E), every step scans all columns with O(1) endpoint lookups.
      */
     static Vektor<EdgeTriple> findShortestPaths(const GraphMatrix* graph, int source= 0,  int destination = -1) {
         const int vertexQuantity = graph->getVertexCount();
@@ -83,22 +83,19 @@ private:
 
     static Vektor<bool> initializeTSPVisited(const int vertexQuantity) {
         Vektor<bool> visited;
-        for (int i = 0; i < vertexQuantity; ++i)
-            visited.push_back(false);
+        visited.append_n(vertexQuantity, false);
         return visited;
     }
 
     static Vektor<int> initializeTSPDistances(const int vertexQuantity) {
         Vektor<int> distances;
-        for (int i = 0; i < vertexQuantity; ++i)
-            distances.push_back(std::numeric_limits<int>::max());
+        distances.append_n(vertexQuantity, std::numeric_limits<int>::max());
         return distances;
     }
 
     static Vektor<int> initializeTSPPrevious(const int vertexQuantity) {
         Vektor<int>  previous;
-        for (int i = 0; i < vertexQuantity; ++i)
-            previous.push_back(-1);
+        previous.append_n(vertexQuantity, -1);
         return  previous;
     }
 
@@ -0,0 +1,113 @@
+#ifndef FORD_BELLMAN_CSR_HPP
+#define FORD_BELLMAN_CSR_HPP
+
+#include "../../GraphsImpl/GraphCSR.hpp"
+#include "../../common/EdgeTriple.hpp"
+#include "../../VektorImpl/Vektor.hpp"
+#include <limits>
+#include <iostream>
+
+class FordBellmanCSR {
+public:
+    /**
+     * Computes shortest paths from the source using Ford-Bellman algorithm
+     * for a directed graph stored in Compressed Sparse Row form.
+     * Stops early once a full pass relaxes no edge.
+     * Time complexity: O(V * E) worst case.
+     */
+    static Vektor<EdgeTriple> findShortestPaths(const GraphCSR* graph, int source = 0, int destination = -1) {
+        const int vertexQuantity = graph->getVertexCount();
+        const int* offsets = graph->getOffsets().begin();
+        const int* destinations = graph->getDestinations().begin();
+        const int* weights = graph->getWeights().begin();
+        constexpr int infinity = std::numeric_limits<int>::max();
+
+        Vektor<int> distances;
+        Vektor<int> previous;
+        distances.append_n(vertexQuantity, infinity);
+        previous.append_n(vertexQuantity, -1);
+        distances[source] = 0;
+
+        for (int i = 1; i < vertexQuantity; ++i) {
+            bool relaxed = false;
+            for (int u = 0; u < vertexQuantity; ++u) {
+                const int distanceU = distances[u];
+                if (distanceU == infinity) continue;
+                for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                    const int v = destinations[j];
+                    if (distanceU + weights[j] < distances[v]) {
+                        distances[v] = distanceU + weights[j];
+                        previous[v] = u;
+                        relaxed = true;
+                    }
+                }
+            }
+            if (!relaxed) break;
+        }
+
+        // Check for negative weight cycles
+        for (int u = 0; u < vertexQuantity; ++u) {
+            if (distances[u] == infinity) continue;
+            for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                if (distances[u] + weights[j] < distances[destinations[j]]) {
+                    std::cerr << "[ERROR] Graph contains a negative weight cycle\n";
+                    return {};
+                }
+            }
+        }
+
+        if (destination != -1)
+            return reconstructSinglePath(previous, distances, source, destination);
+        return reconstructAllPaths(previous, distances, source);
+    }
+
+    static std::string calculatePathWeightAsString(const Vektor<EdgeTriple>& paths, bool destination=false) {
+        if (paths.size() == 0) return "0";
+        if (paths.size() == 1) return std::to_string(paths[0].weight);
+
+        int minW = paths[0].weight;
+        int maxW = paths[0].weight;
+        for (int i = 1; i < paths.size(); ++i) {
+            if (paths[i].weight < minW) minW = paths[i].weight;
+            if (paths[i].weight > maxW) maxW = paths[i].weight;
+        }
+
+        if (minW == maxW || destination) return std::to_string(maxW);
+        return "[" + std::to_string(minW) + " - " + std::to_string(maxW) + "]";
+    }
+
+    static void displayShortestPaths(const Vektor<EdgeTriple>& paths, int source) {
+        int total = 0;
+        std::cout << "Ford-Bellman (CSR) shortest paths from source " << source << ":\n";
+        for (int i = paths.size() - 1; i >= 0; --i) {
+            const auto&[from, to, weight] = paths[i];
+            std::cout << from << " -> " << to << " [weight=" << weight << "]\n";
+            total += weight;
+        }
+        std::cout << "Total Path weight: " << total << "\n";
+    }
+
+private:
+    static Vektor<EdgeTriple> reconstructAllPaths(const Vektor<int>& previous, const Vektor<int>& distances, int source) {
+        Vektor<EdgeTriple> result;
+        for (int i = 0; i < previous.size(); ++i) {
+            if (i != source && previous[i] != -1 && distances[i] != std::numeric_limits<int>::max()) {
+                result.push_back({previous[i], i, distances[i]});
+            }
+        }
+        return result;
+    }
+
+    static Vektor<EdgeTriple> reconstructSinglePath(const Vektor<int>& previous, const Vektor<int>& distances, int source, int dest) {
+        Vektor<EdgeTriple> result;
+        if (distances[dest] == std::numeric_limits<int>::max()) return result;
+        int current = dest;
+        while (current != source && previous[current] != -1) {
+            result.push_back({previous[current], current, distances[current]});
+            current = previous[current];
+        }
+        return result;
+    }
+};
+
+#endif
@@ -11,10 +11,11 @@ class FordBellmanList {
 public:
     /**
      * Computes shortest paths from the source using Ford-Bellman algorithm
-     * for a directed graph represented as an adjacency list.
+     * for a directed graph represented as an adjacency list (GraphList or SmallGraphList).
      * Time complexity: O(V * E)
      */
-    static Vektor<EdgeTriple> findShortestPaths(const GraphList* graph, int source = 0, int destination = -1) {
+    template <typename Graph>
+    static Vektor<EdgeTriple> findShortestPaths(const Graph* graph, int source = 0, int destination = -1) {
         const int vertexQuantity = graph->getVertexCount();
         Vektor<int> distances = initializeTSPDistances(vertexQuantity);
         Vektor<int> previous = initializeTSPPreviousParents(vertexQuantity);
@@ -22,7 +23,7 @@ public:
 
         for (int i = 1; i < vertexQuantity; ++i) {
             for (int u = 0; u < vertexQuantity; ++u) {
-                const Vektor<Edge>& neighbors = graph->getNeighbors(u);
+                const auto& neighbors = graph->getNeighbors(u);
                 for (int j = 0; j < neighbors.size(); ++j) {
                     int v = neighbors[j].dest;
                     int weight = neighbors[j].weight;
@@ -36,7 +37,7 @@ public:
 
         // Check for negative weight cycles
         for (int u = 0; u < vertexQuantity; ++u) {
-            const Vektor<Edge>& neighbors = graph->getNeighbors(u);
+            const auto& neighbors = graph->getNeighbors(u);
             for (int j = 0; j < neighbors.size(); ++j) {
                 int v = neighbors[j].dest;
                 int weight = neighbors[j].weight;
@@ -82,15 +83,13 @@ private:
 
     static Vektor<int> initializeTSPDistances(const int vertexQuantity) {
         Vektor<int> distances;
-        for (int i = 0; i < vertexQuantity; ++i)
-            distances.push_back(std::numeric_limits<int>::max());
+        distances.append_n(vertexQuantity, std::numeric_limits<int>::max());
         return distances;
     }
 
     static Vektor<int> initializeTSPPreviousParents(const int vertexQuantity) {
         Vektor<int> previous;
-        for (int i = 0; i < vertexQuantity; ++i)
-            previous.push_back(-1);
+        previous.append_n(vertexQuantity, -1);
         return previous;
     }
 
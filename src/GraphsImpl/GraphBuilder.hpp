@@ -0,0 +1,74 @@
+#ifndef GRAPH_BUILDER_HPP
+#define GRAPH_BUILDER_HPP
+
+#include <type_traits>
+
+#include "../VektorImpl/Vektor.hpp"
+#include "../common/EdgeTriple.hpp"
+#include "GraphConcept.hpp"
+#include "GraphList.hpp"
+#include "GraphMatrix.hpp"
+#include "GraphCSR.hpp"
+#include "GraphDense.hpp"
+
+/**
+ * Inserts all edges and finalizes the graph. Instantiated per representation, so addEdge() is inlined.
+ * Time complexity: O(E) plus the representation's finalize().
+ */
+template <GraphRepresentation G>
+void insertEdges(G& graph, const Vektor<EdgeTriple>& edges) {
+    for (int i = 0; i < edges.size(); ++i) {
+        graph.addEdge(edges[i].from, edges[i].to, edges[i].weight);
+    }
+    graph.finalize();
+}
+
+/**
+ * Builds a graph from a complete edge list in one go.
+ * Every representation gets its storage at final size before the first edge is written:
+ * adjacency lists reserve each vertex's out-degree from a counting pass, the incidence matrix
+ * reserves exactly E columns, CSR lays out its arrays directly, and the dense matrix is allocated once.
+ */
+class GraphBuilder {
+public:
+    /**
+     * Time complexity: O(V + E), O(V^2) for GraphDense.
+     */
+    template <GraphRepresentation G>
+    static G build(const int vertices, const Vektor<EdgeTriple>& edges) {
+        if constexpr (std::is_same_v<G, GraphCSR>) {
+            return G(vertices, edges);
+        } else if constexpr (std::is_same_v<G, GraphMatrix>) {
+            G graph(vertices, edges.size());
+            insertEdges(graph, edges);
+            return graph;
+        } else if constexpr (requires(G& graph) { graph.reserveNeighbors(0, 0); }) {
+            G graph(vertices);
+            const Vektor<int> outDegrees = countOutDegrees(vertices, edges);
+            for (int u = 0; u < vertices; ++u) {
+                graph.reserveNeighbors(u, outDegrees[u]);
+            }
+            insertEdges(graph, edges);
+            return graph;
+        } else {
+            G graph(vertices);
+            insertEdges(graph, edges);
+            return graph;
+        }
+    }
+
+private:
+    /**
+     * Counting pass: number of outgoing edges per vertex, self-loops excluded.
+     * Time complexity: O(V + E)
+     */
+    static Vektor<int> countOutDegrees(const int vertices, const Vektor<EdgeTriple>& edges) {
+        Vektor<int> outDegrees(vertices);
+        for (int i = 0; i < edges.size(); ++i) {
+            if (edges[i].from != edges[i].to) ++outDegrees[edges[i].from];
+        }
+        return outDegrees;
+    }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef GRAPHCSR_HPP
+#define GRAPHCSR_HPP
+
+#include <iostream>
+
+#include "../VektorImpl/Vektor.hpp"
+#include "../common/EdgeTriple.hpp"
+#include "GraphConcept.hpp"
+
+/**
+ * Graph stored in Compressed Sparse Row form: the outgoing edges of vertex u are
+ * destinations[offsets[u] .. offsets[u + 1]) with matching weights, all in contiguous arrays.
+ * A transposed copy (incoming edges) is kept as well, so undirected algorithms can scan both directions.
+ *
+ * Edges are either passed in bulk to the constructor or staged with addEdge() and compacted by finalize().
+ */
+class GraphCSR {
+    int vertexCount;
+    int edgeCount;
+    Vektor<EdgeTriple> stagedEdges;
+
+    Vektor<int> offsets;
+    Vektor<int> destinations;
+    Vektor<int> weights;
+
+    Vektor<int> inOffsets;
+    Vektor<int> sources;
+    Vektor<int> inWeights;
+
+public:
+    /**
+     * Constructs an empty graph; expectedEdges only pre-sizes the staging buffer.
+     * Time complexity: O(V)
+     */
+    explicit GraphCSR(int vertices, int expectedEdges = 0) : vertexCount(vertices), edgeCount(0) {
+        stagedEdges.reserve(expectedEdges);
+        layout(stagedEdges);
+    }
+
+    /**
+     * Builds the CSR arrays directly from an edge list, without staging a copy.
+     * Time complexity: O(V + E)
+     */
+    GraphCSR(int vertices, const Vektor<EdgeTriple>& edges) : vertexCount(vertices), edgeCount(0) {
+        layout(edges);
+    }
+
+    /**
+     * Stages a directed edge; it becomes visible after finalize().
+     * Time complexity: O(1) amortized
+     */
+    void addEdge(int from, int to, int weight) {
+        if (from == to)
+            return;
+        stagedEdges.push_back({from, to, weight});
+    }
+
+    /**
+     * Compacts all staged edges into the CSR arrays.
+     * Time complexity: O(V + E)
+     */
+    void finalize() {
+        if (!stagedEdges.empty())
+            build();
+    }
+
+    /**
+     * Displays outgoing edges of every vertex.
+     * Time complexity: O(V + E)
+     */
+    void display() const {
+        std::cout << "Compressed Sparse Row:\n";
+        for (int u = 0; u < vertexCount; ++u) {
+            std::cout << "e" << u << ": ";
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                std::cout << "(" << destinations[i] << ", " << weights[i] << ") ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    int getVertexCount() const {
+        return vertexCount;
+    }
+
+    int getEdgeCount() const {
+        return edgeCount;
+    }
+
+    /// Outgoing edges of u occupy indices [getOffsets()[u], getOffsets()[u + 1]).
+    const Vektor<int>& getOffsets() const { return offsets; }
+    const Vektor<int>& getDestinations() const { return destinations; }
+    const Vektor<int>& getWeights() const { return weights; }
+
+    /// Incoming edges of v occupy indices [getInOffsets()[v], getInOffsets()[v + 1]).
+    const Vektor<int>& getInOffsets() const { return inOffsets; }
+    const Vektor<int>& getSources() const { return sources; }
+    const Vektor<int>& getInWeights() const { return inWeights; }
+
+private:
+    /**
+     * Merges staged edges with the already built arrays and lays everything out again.
+     */
+    void build() {
+        Vektor<EdgeTriple> allEdges;
+        allEdges.reserve(edgeCount + stagedEdges.size());
+        for (int u = 0; u < vertexCount && edgeCount > 0; ++u) {
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i)
+                allEdges.push_back({u, destinations[i], weights[i]});
+        }
+        allEdges.insertEnd(stagedEdges.begin(), stagedEdges.end());
+        stagedEdges = Vektor<EdgeTriple>();
+
+        layout(allEdges);
+    }
+
+    /**
+     * Lays both directions out with a counting pass, a prefix sum and a scatter pass; self-loops are dropped.
+     */
+    void layout(const Vektor<EdgeTriple>& edges) {
+        edgeCount = 0;
+        for (int i = 0; i < edges.size(); ++i) {
+            if (edges[i].from != edges[i].to) ++edgeCount;
+        }
+
+        scatter(edges, offsets, destinations, weights, false);
+        scatter(edges, inOffsets, sources, inWeights, true);
+    }
+
+    /**
+     * Fills one CSR direction; reversed == true groups edges by their destination.
+     */
+    void scatter(const Vektor<EdgeTriple>& edges, Vektor<int>& rowOffsets, Vektor<int>& columns,
+                 Vektor<int>& columnWeights, bool reversed) const {
+        rowOffsets = Vektor<int>(vertexCount + 1);
+        columns = Vektor<int>(edgeCount);
+        columnWeights = Vektor<int>(edgeCount);
+
+        for (int i = 0; i < edges.size(); ++i) {
+            if (edges[i].from != edges[i].to)
+                ++rowOffsets[(reversed ? edges[i].to : edges[i].from) + 1];
+        }
+        for (int u = 0; u < vertexCount; ++u)
+            rowOffsets[u + 1] += rowOffsets[u];
+
+        Vektor<int> cursor = rowOffsets;
+        for (int i = 0; i < edges.size(); ++i) {
+            if (edges[i].from == edges[i].to) continue;
+            const int row = reversed ? edges[i].to : edges[i].from;
+            const int slot = cursor[row]++;
+            columns[slot] = reversed ? edges[i].from : edges[i].to;
+            columnWeights[slot] = edges[i].weight;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef GRAPH_CONCEPT_HPP
+#define GRAPH_CONCEPT_HPP
+
+#include <concepts>
+
+/**
+ * Interface every graph representation provides. Loaders, generators and algorithms are templates
+ * constrained on it, so calls such as addEdge() are resolved at compile time and inlined
+ * instead of going through a vtable.
+ *
+ * finalize() is called once after the last addEdge(); representations that build in bulk compact there.
+ */
+template <typename G>
+concept GraphRepresentation = requires(G graph, const G constGraph, int vertex, int weight) {
+    graph.addEdge(vertex, vertex, weight);
+    graph.finalize();
+    constGraph.display();
+    { constGraph.getVertexCount() } -> std::convertible_to<int>;
+    { constGraph.getEdgeCount() } -> std::convertible_to<int>;
+};
+
+#endif
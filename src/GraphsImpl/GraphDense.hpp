@@ -0,0 +1,168 @@
+#ifndef GRAPHDENSE_HPP
+#define GRAPHDENSE_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+
+#include "GraphConcept.hpp"
+
+/**
+ * Graph represented using a V x V adjacency matrix of weights (good for near-complete graphs).
+ * Rows are stored flat and row-major; every row starts on a cache line, so scans over a row
+ * are contiguous and can be vectorized.
+ *
+ * Two matrices are kept: the directed weights (used by Dijkstra) and the symmetric minimum
+ * of both directions (used by Prim, which treats the graph as undirected).
+ */
+class GraphDense {
+public:
+    /// Weight stored for a missing edge; small enough that distance + NO_EDGE does not overflow.
+    static constexpr int NO_EDGE = std::numeric_limits<int>::max() / 2;
+    static constexpr int CACHE_LINE = 64;
+
+private:
+    int vertexCount;
+    int edgeCount;
+    int stride;
+    std::pmr::memory_resource* resource;
+    int* directed;
+    int* symmetric;
+
+public:
+    /**
+     * Constructs a graph with no edges.
+     * Time complexity: O(V^2)
+     */
+    explicit GraphDense(const int vertices)
+        : vertexCount(vertices), edgeCount(0), stride(paddedStride(vertices)),
+          resource(std::pmr::get_default_resource()), directed(allocateMatrix()), symmetric(allocateMatrix()) {}
+
+    GraphDense(const GraphDense&) = delete;
+    GraphDense& operator=(const GraphDense&) = delete;
+
+    GraphDense(GraphDense&& other) noexcept
+        : vertexCount(other.vertexCount), edgeCount(other.edgeCount), stride(other.stride),
+          resource(other.resource), directed(other.directed), symmetric(other.symmetric) {
+        other.directed = nullptr;
+        other.symmetric = nullptr;
+    }
+
+    GraphDense& operator=(GraphDense&& other) noexcept {
+        if (this != &other) {
+            releaseMatrix(directed);
+            releaseMatrix(symmetric);
+            vertexCount = other.vertexCount;
+            edgeCount = other.edgeCount;
+            stride = other.stride;
+            resource = other.resource;
+            directed = std::exchange(other.directed, nullptr);
+            symmetric = std::exchange(other.symmetric, nullptr);
+        }
+        return *this;
+    }
+
+    ~GraphDense() {
+        releaseMatrix(directed);
+        releaseMatrix(symmetric);
+    }
+
+    /**
+     * Adds a directed edge; for parallel edges the lighter one is kept.
+     * Time complexity: O(1)
+     */
+    void addEdge(const int from, const int to, const int weight) {
+        if (from == to) return;
+
+        int& cell = directed[static_cast<std::size_t>(from) * stride + to];
+        if (cell == NO_EDGE) ++edgeCount;
+        if (weight < cell) cell = weight;
+
+        int& forward = symmetric[static_cast<std::size_t>(from) * stride + to];
+        int& backward = symmetric[static_cast<std::size_t>(to) * stride + from];
+        if (weight < forward) {
+            forward = weight;
+            backward = weight;
+        }
+    }
+
+    /**
+     * Cells are written in place; nothing to compact.
+     */
+    void finalize() {}
+
+    /**
+     * Displays the directed weight matrix; '-' marks a missing edge.
+     * Time complexity: O(V^2)
+     */
+    void display() const {
+        std::cout << "Adjacency Matrix (" << vertexCount << " x " << vertexCount << "):\n";
+
+        std::cout << "\t";
+        for (int j = 0; j < vertexCount; ++j) {
+            std::cout << "v" << j << "\t";
+        }
+        std::cout << "\n";
+
+        for (int i = 0; i < vertexCount; ++i) {
+            std::cout << "v" << i << "\t";
+            const int* row = getRow(i);
+            for (int j = 0; j < vertexCount; ++j) {
+                if (row[j] == NO_EDGE) std::cout << "-\t";
+                else std::cout << row[j] << "\t";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    int getVertexCount() const {
+        return vertexCount;
+    }
+
+    int getEdgeCount() const {
+        return edgeCount;
+    }
+
+    /**
+     * Returns the directed weights of edges leaving u, indexed by destination.
+     * Time complexity: O(1)
+     */
+    const int* getRow(const int u) const {
+        return directed + static_cast<std::size_t>(u) * stride;
+    }
+
+    /**
+     * Returns min(w(u, v), w(v, u)) for every v, i.e. the undirected view of row u.
+     * Time complexity: O(1)
+     */
+    const int* getSymmetricRow(const int u) const {
+        return symmetric + static_cast<std::size_t>(u) * stride;
+    }
+
+private:
+    /// Rounds the row length up to a whole number of cache lines.
+    static int paddedStride(const int vertices) {
+        constexpr int intsPerLine = CACHE_LINE / static_cast<int>(sizeof(int));
+        return (vertices + intsPerLine - 1) / intsPerLine * intsPerLine;
+    }
+
+    std::size_t matrixBytes() const {
+        return static_cast<std::size_t>(vertexCount) * stride * sizeof(int);
+    }
+
+    int* allocateMatrix() const {
+        const std::size_t cells = static_cast<std::size_t>(vertexCount) * stride;
+        int* matrix = static_cast<int*>(resource->allocate(matrixBytes(), CACHE_LINE));
+        for (std::size_t i = 0; i < cells; ++i) matrix[i] = NO_EDGE;
+        return matrix;
+    }
+
+    void releaseMatrix(int* matrix) const {
+        if (matrix == nullptr) return;
+        resource->deallocate(matrix, matrixBytes(), CACHE_LINE);
+    }
+};
+
+#endif
@@ -2,9 +2,10 @@
 #ifndef GRAPHLIST_HPP
 #define GRAPHLIST_HPP
 #include "../VektorImpl/Vektor.hpp"
+#include "../VektorImpl/SmallVektor.hpp"
 #include <iostream>
 
-#include "IGraph.hpp"
+#include "GraphConcept.hpp"
 
 /**
  * Struct representing a single edge in adjacency list.
@@ -16,25 +17,27 @@ struct Edge {
 
 /**
  * Graph represented using an adjacency list (sparse graph friendly).
+ * AdjacencyContainer is the per-vertex edge container (Vektor<Edge> or an inline SmallVektor).
  */
-class GraphList: public IGraph{
+template <typename AdjacencyContainer>
+class BasicGraphList {
     int vertexCount;
     int edgeCount;
-    Vektor<Vektor<Edge>> adjList;
+    Vektor<AdjacencyContainer> adjList;
 
 public:
     /**
      * Constructs a graph with the given number of vertices.
      * Time complexity: O(V), where V is the number of vertices.
      */
-    GraphList(int vertices): vertexCount(vertices), edgeCount(0), adjList(vertices) {}
+    BasicGraphList(int vertices): vertexCount(vertices), edgeCount(0), adjList(vertices) {}
 
 
     /**
      * Adds a directed edge from 'from' to 'to' with specified weight.
      * Time complexity: O(1)
      */
-    void addEdge(int from, int to, int weight) override {
+    void addEdge(int from, int to, int weight) {
         Edge edge = {to, weight};
         if (from == to)
             return;
@@ -42,11 +45,24 @@ public:
         edgeCount++;
     }
 
+    /**
+     * Pre-sizes the edge container of a node, e.g. to its out-degree before a bulk build.
+     * Time complexity: O(count)
+     */
+    void reserveNeighbors(int node, int count) {
+        adjList[node].reserve(count);
+    }
+
+    /**
+     * Edges are visible as soon as they are added; nothing to compact.
+     */
+    void finalize() {}
+
     /**
     * Returns all outgoing edges from a given node.
     * Time complexity: O(1)
     */
-    const Vektor<Edge>& getNeighbors(int node) const {
+    const AdjacencyContainer& getNeighbors(int node) const {
         return adjList[node];
     }
 
@@ -54,7 +70,7 @@ public:
     * Displays the adjacency list of the graph.
     * Time complexity: O(V + E)
     */
-    void display() const override {
+    void display() const {
         std::cout << "Adjacency List:\n";
         for (int i = 0; i < vertexCount; ++i) {
             std::cout << "e" << i << ": ";
@@ -69,7 +85,7 @@ public:
     * Returns the number of vertices.
     * Time complexity: O(1)
     */
-    int getVertexCount() const override {
+    int getVertexCount() const {
         return vertexCount;
     }
 
@@ -77,9 +93,15 @@ public:
      * Returns the total number of added edges.
      * Time complexity: O(1)
      */
-    int getEdgeCount() const override {
+    int getEdgeCount() const {
         return edgeCount;
     }
 };
 
+/// Adjacency list with one heap-allocated Vektor per vertex.
+using GraphList = BasicGraphList<Vektor<Edge>>;
+
+/// Adjacency list keeping up to four edges per vertex inline, without a separate allocation.
+using SmallGraphList = BasicGraphList<SmallVektor<Edge, 4>>;
+
 #endif
@@ -4,40 +4,28 @@
 #include "../VektorImpl/Vektor.hpp"
 #include <iostream>
 
-#include "IGraph.hpp"
+#include "GraphConcept.hpp"
+#include "IncidenceStorage.hpp"
 
 /**
  * Graph represented using an incidence matrix (good for dense graphs).
- * Each column corresponds to an edge.
+ * Each column corresponds to an edge; columns are kept in IncidenceStorage,
+ * which stores only the two non-zero rows of every column.
  */
-class GraphMatrix : public IGraph {
+class GraphMatrix {
     int vertexCount;
     int edgeLimit;
-    int currentEdge;
-    Vektor<Vektor<int>> matrix; // Matrix: vertexCount x edgeLimit
-    Vektor<int> weights;
+    IncidenceStorage incidence; // Matrix: vertexCount x edgeLimit, stored by column endpoints
 
 public:
     /**
     * Constructs an incidence matrix graph with given number of vertices and max edges.
-    * Time complexity: O(V * E)
+    * Time complexity: O(1), storage for maxEdges columns is reserved up front.
     */
     GraphMatrix(const int vertices, const int maxEdges)
-        : vertexCount(vertices), edgeLimit(maxEdges), currentEdge(0)
+        : vertexCount(vertices), edgeLimit(maxEdges)
     {
-        // Initialize incidence matrix: V rows, each with E zeros
-        for (int i = 0; i < vertexCount; ++i) {
-            Vektor<int> row;
-            for (int j = 0; j < edgeLimit; ++j) {
-                row.push_back(0);
-            }
-            matrix.push_back(row);
-        }
-
-        // Prepare edge vectors
-        for (int i = 0; i < edgeLimit; ++i) {
-            weights.push_back(0);
-        }
+        incidence.reserve(edgeLimit);
     }
 
     /**
@@ -45,23 +33,26 @@ public:
     * Represented by marking u with 1 and v with -1 in the matrix.
     * Time complexity: O(1)
     */
-    void addEdge(const int u, const int v, const int weight) override {
+    void addEdge(const int u, const int v, const int weight) {
         if (u == v) return;
-        if (currentEdge >= edgeLimit) {
+        if (incidence.columnCount() >= edgeLimit) {
             std::cerr << "[GraphMatrix] Edge limit reached!\n";
             return;
         }
 
-        matrix[u][currentEdge] = 1;
-        matrix[v][currentEdge] = -1;
-        weights[currentEdge] = weight;
-        currentEdge++;
+        incidence.appendColumn(u, v, weight);
     }
 
+    /**
+     * Columns are appended in place; nothing to compact.
+     */
+    void finalize() {}
+
     /**
      * Displays the incidence matrix of the graph.
      */
-    void display() const override {
+    void display() const {
+        const int currentEdge = incidence.columnCount();
         std::cout << "Incidence Matrix (" << vertexCount << " x " << currentEdge << "):\n";
 
         std::cout << "\t";
@@ -73,7 +64,7 @@ public:
         for (int i = 0; i < vertexCount; ++i) {
             std::cout << "e" << i << "\t";
             for (int j = 0; j < currentEdge; ++j) {
-                std::cout << matrix[i][j] << "\t";
+                std::cout << incidence.cell(i, j) << "\t";
             }
             std::cout << std::endl;
         }
@@ -83,7 +74,7 @@ public:
      * Returns the number of vertices in the graph.
      * Time complexity: O(1)
      */
-    int getVertexCount() const override {
+    int getVertexCount() const {
         return vertexCount;
     }
 
@@ -91,30 +82,24 @@ public:
      * Returns the current number of added edges.
      * Time complexity: O(1)
      */
-    int getEdgeCount() const override {
-        return currentEdge;
+    int getEdgeCount() const {
+        return incidence.columnCount();
     }
 
     /**
      * Returns the source vertex of a given edge index (1 in matrix).
-     * Time complexity: O(V)
+     * Time complexity: O(1)
      */
     int getFrom(const int edgeIndex) const {
-        for (int u = 0; u < vertexCount; ++u) {
-            if (matrix[u][edgeIndex] == 1) return u;
-        }
-        return -1;
+        return incidence.source(edgeIndex);
     }
 
     /**
      * Returns the destination vertex of a given edge index (-1 in matrix).
-     * Time complexity: O(V)
+     * Time complexity: O(1)
      */
     int getDest(const int edgeIndex) const {
-        for (int v = 0; v < vertexCount; ++v) {
-            if (matrix[v][edgeIndex] == -1) return v;
-        }
-        return -1;
+        return incidence.destination(edgeIndex);
     }
 
     /**
@@ -122,7 +107,7 @@ public:
      * Time complexity: O(1)
      */
     int getWeight(const int edgeIndex) const {
-        return weights[edgeIndex];
+        return incidence.weight(edgeIndex);
     }
 
 };
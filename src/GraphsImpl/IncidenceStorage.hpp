@@ -0,0 +1,53 @@
+#ifndef INCIDENCE_STORAGE_HPP
+#define INCIDENCE_STORAGE_HPP
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Column-compressed incidence matrix: every column has exactly one +1 (source) and one -1 (destination),
+ * so only those two row indices and the weight are stored per edge.
+ * Memory is O(E) instead of O(V * E), and both endpoints of an edge are read in O(1).
+ */
+class IncidenceStorage {
+    Vektor<int> sources;
+    Vektor<int> destinations;
+    Vektor<int> weights;
+
+public:
+    /**
+     * Reserves room for expectedEdges columns.
+     * Time complexity: O(1)
+     */
+    void reserve(const int expectedEdges) {
+        sources.reserve(expectedEdges);
+        destinations.reserve(expectedEdges);
+        weights.reserve(expectedEdges);
+    }
+
+    /**
+     * Appends a column with +1 in row u and -1 in row v.
+     * Time complexity: O(1) amortized
+     */
+    void appendColumn(const int u, const int v, const int weight) {
+        sources.push_back(u);
+        destinations.push_back(v);
+        weights.push_back(weight);
+    }
+
+    /**
+     * Returns the incidence matrix cell: 1 for the source, -1 for the destination, 0 otherwise.
+     * Time complexity: O(1)
+     */
+    int cell(const int vertex, const int edgeIndex) const {
+        if (sources[edgeIndex] == vertex) return 1;
+        if (destinations[edgeIndex] == vertex) return -1;
+        return 0;
+    }
+
+    int columnCount() const { return weights.size(); }
+    int source(const int edgeIndex) const { return sources[edgeIndex]; }
+    int destination(const int edgeIndex) const { return destinations[edgeIndex]; }
+    int weight(const int edgeIndex) const { return weights[edgeIndex]; }
+};
+
+#endif
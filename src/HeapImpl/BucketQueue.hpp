@@ -0,0 +1,76 @@
+#ifndef BUCKET_QUEUE_HPP
+#define BUCKET_QUEUE_HPP
+
+#include <utility>
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Dial's circular bucket queue of (key, value) pairs with small non-negative integer keys.
+ * Drop-in for MinHeap<std::pair<int, int>> in Dijkstra: push, top, pop and empty have the same meaning.
+ * Monotone: every pushed key must lie in [last popped key, last popped key + maxKeyGap], which holds for
+ * Dijkstra when maxKeyGap is the largest edge weight. All queued keys then fall into maxKeyGap + 1
+ * consecutive values, so bucket key % (maxKeyGap + 1) holds exactly one key and the minimum is found by
+ * moving a cursor forward instead of restoring heap order.
+ * The queue holds one bucket per possible key gap, so maxKeyGap is capped at MAX_KEY_GAP; callers with
+ * heavier edges have to use a heap instead.
+ */
+class BucketQueue {
+    Vektor<Vektor<int>> buckets;  // values of the entries whose key maps to the bucket
+    int bucketCount;
+    int cursor = 0;               // bucket of currentKey
+    int currentKey = 0;           // smallest queued key
+    int count = 0;
+
+public:
+    static constexpr const char* NAME = "Dial buckets";
+    static constexpr int MAX_KEY_GAP = 1 << 16;
+
+    /**
+     * maxKeyGap must lie in [0, MAX_KEY_GAP].
+     * Time complexity: O(maxKeyGap)
+     */
+    explicit BucketQueue(int maxKeyGap) : buckets(maxKeyGap + 1), bucketCount(maxKeyGap + 1) {}
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    std::pair<int, int> top() const {
+        const Vektor<int>& bucket = buckets[cursor];
+        return {currentKey, bucket[bucket.size() - 1]};
+    }
+
+    /**
+     * Time complexity: O(1)
+     */
+    void push(const std::pair<int, int>& entry) {
+        // pop() already moved on to the next queued key; a key between it and the one popped pulls the cursor back.
+        if (count == 0 || entry.first < currentKey) {
+            currentKey = entry.first;
+            cursor = entry.first % bucketCount;
+        }
+        buckets[entry.first % bucketCount].push_back(entry.second);
+        ++count;
+    }
+
+    /**
+     * Time complexity: O(1) amortized; the cursor passes every key between two minima once, O(maxKeyGap) at worst.
+     */
+    void pop() {
+        if (empty()) return;
+        Vektor<int>& bucket = buckets[cursor];
+        bucket.removeAt(bucket.size() - 1);
+        if (--count == 0) return;
+        while (buckets[cursor].empty()) {
+            cursor = cursor + 1 == bucketCount ? 0 : cursor + 1;
+            ++currentKey;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef INDEXED_MIN_HEAP_HPP
+#define INDEXED_MIN_HEAP_HPP
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Addressable d-ary min-heap over the ids 0..capacity-1, each id present at most once with a key.
+ * A position array maps every id to its heap slot, so a key can be lowered in place (decrease-key)
+ * instead of pushing a duplicate entry and skipping stale ones on pop, as MinHeap users have to.
+ * Arity 4 keeps the tree half as deep as a binary heap, which favours the decrease-key heavy workloads
+ * of Prim and Dijkstra; Arity 2 gives the classic binary heap.
+ * AccessPolicy selects checked or unchecked element access of the underlying storage.
+ */
+template <typename Key, int Arity = 4, typename AccessPolicy = DefaultAccessPolicy>
+class IndexedMinHeap {
+    static_assert(Arity >= 2, "IndexedMinHeap needs at least two children per node");
+    static constexpr int ABSENT = -1;
+
+    /// Keys live next to their ids in the slots, so comparing siblings reads one contiguous block.
+    struct Entry {
+        Key key;
+        int id;
+    };
+
+    Vektor<Entry, DoublingGrowth, AccessPolicy> heap;     // heap slot -> (key, id)
+    Vektor<int, DoublingGrowth, AccessPolicy> positions;  // id -> heap slot, ABSENT if not queued
+
+public:
+    /**
+     * Creates an empty heap for the ids 0..capacity-1.
+     * Time complexity: O(capacity)
+     */
+    explicit IndexedMinHeap(int capacity) {
+        heap.reserve(capacity);
+        positions.append_n(capacity, ABSENT);
+    }
+
+    bool empty() const {
+        return heap.size() == 0;
+    }
+
+    int size() const {
+        return heap.size();
+    }
+
+    bool contains(int id) const {
+        return positions[id] != ABSENT;
+    }
+
+    /// Key of a queued id.
+    const Key& keyOf(int id) const {
+        return heap[positions[id]].key;
+    }
+
+    /// Id with the smallest key.
+    int topId() const {
+        return heap[0].id;
+    }
+
+    const Key& topKey() const {
+        return heap[0].key;
+    }
+
+    /**
+     * Queues an id that is not in the heap yet.
+     * Time complexity: O(log_d n)
+     */
+    void push(int id, const Key& key) {
+        positions[id] = heap.size();
+        heap.push_back({key, id});
+        siftUp(heap.size() - 1);
+    }
+
+    /**
+     * Lowers the key of a queued id; a key that is not smaller is ignored.
+     * Time complexity: O(log_d n)
+     */
+    void decreaseKey(int id, const Key& key) {
+        const int slot = positions[id];
+        if (!(key < heap[slot].key)) return;
+        heap[slot].key = key;
+        siftUp(slot);
+    }
+
+    /**
+     * Queues the id or lowers its key, whichever applies. Returns true if the key changed.
+     * Time complexity: O(log_d n)
+     */
+    bool pushOrDecrease(int id, const Key& key) {
+        if (!contains(id)) {
+            push(id, key);
+            return true;
+        }
+        const int slot = positions[id];
+        if (!(key < heap[slot].key)) return false;
+        heap[slot].key = key;
+        siftUp(slot);
+        return true;
+    }
+
+    /**
+     * Removes and returns the id with the smallest key.
+     * Time complexity: O(d * log_d n)
+     */
+    int pop() {
+        const int top = heap[0].id;
+        const Entry last = heap[heap.size() - 1];
+        heap.removeAt(heap.size() - 1);
+        positions[top] = ABSENT;
+        if (heap.size() > 0) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+
+private:
+    /// Moves the entry at slot up while its key is smaller than its parent's; entries are shifted, not swapped.
+    void siftUp(int slot) {
+        const Entry entry = heap[slot];
+        while (slot > 0) {
+            const int parent = (slot - 1) / Arity;
+            if (!(entry.key < heap[parent].key)) break;
+            place(slot, heap[parent]);
+            slot = parent;
+        }
+        place(slot, entry);
+    }
+
+    /// Moves the entry at slot down past its smallest child while that child's key is smaller.
+    void siftDown(int slot) {
+        const Entry entry = heap[slot];
+        const int n = heap.size();
+        while (true) {
+            const int firstChild = Arity * slot + 1;
+            if (firstChild >= n) break;
+            const int lastChild = firstChild + Arity < n ? firstChild + Arity : n;
+            int best = firstChild;
+            for (int child = firstChild + 1; child < lastChild; ++child) {
+                if (heap[child].key < heap[best].key) best = child;
+            }
+            if (!(heap[best].key < entry.key)) break;
+            place(slot, heap[best]);
+            slot = best;
+        }
+        place(slot, entry);
+    }
+
+    void place(int slot, const Entry& entry) {
+        heap[slot] = entry;
+        positions[entry.id] = slot;
+    }
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef LOSER_TREE_HPP
+#define LOSER_TREE_HPP
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Tournament (loser) tree for k-way merging of sorted sources.
+ * Each inner node stores the source that lost the match played there and node 0 stores the overall winner,
+ * so replacing the winner's key replays only the matches on its leaf-to-root path:
+ * exactly ceil(log2 k) comparisons per element, against about 2 log2 k for a binary heap.
+ * Exhausted sources lose every match; ties go to the lower source index, which keeps merges stable.
+ */
+template <typename T>
+class LoserTree {
+    int sourceCount;
+    Vektor<int> tree;
+    Vektor<T> keys;
+    Vektor<char> exhausted;
+    int remaining;
+
+public:
+    /// Creates a tree for sourceCount sources, all exhausted until set() gives them a first key.
+    explicit LoserTree(int sources)
+        : sourceCount(sources), tree(sources), keys(sources), exhausted(sources), remaining(0) {
+        for (int i = 0; i < sourceCount; ++i)
+            exhausted[i] = 1;
+    }
+
+    /// Sets the first key of a source; call build() after all sources are set.
+    void set(int source, const T& key) {
+        keys[source] = key;
+        if (exhausted[source]) ++remaining;
+        exhausted[source] = 0;
+    }
+
+    /**
+     * Plays all matches once.
+     * Time complexity: O(k)
+     */
+    void build() {
+        if (sourceCount == 0) return;
+        tree[0] = sourceCount == 1 ? 0 : buildNode(1);
+    }
+
+    bool empty() const {
+        return remaining == 0;
+    }
+
+    int winner() const {
+        return tree[0];
+    }
+
+    const T& winnerKey() const {
+        return keys[tree[0]];
+    }
+
+    /**
+     * Replaces the winner's key with the next key of the same source and replays its path.
+     * Time complexity: O(log k)
+     */
+    void replaceWinner(const T& key) {
+        keys[tree[0]] = key;
+        replay(tree[0]);
+    }
+
+    /**
+     * Marks the winner's source as exhausted and replays its path.
+     * Time complexity: O(log k)
+     */
+    void exhaustWinner() {
+        exhausted[tree[0]] = 1;
+        --remaining;
+        replay(tree[0]);
+    }
+
+private:
+    /// True when source a wins against source b.
+    bool beats(int a, int b) const {
+        if (exhausted[a]) return false;
+        if (exhausted[b]) return true;
+        if (keys[a] < keys[b]) return true;
+        if (keys[b] < keys[a]) return false;
+        return a < b;
+    }
+
+    /// Leaves are the virtual nodes k..2k-1; returns the winner of the subtree and stores losers on the way.
+    int buildNode(int node) {
+        if (node >= sourceCount)
+            return node - sourceCount;
+        const int left = buildNode(2 * node);
+        const int right = buildNode(2 * node + 1);
+        if (beats(left, right)) {
+            tree[node] = right;
+            return left;
+        }
+        tree[node] = left;
+        return right;
+    }
+
+    void replay(int source) {
+        int candidate = source;
+        for (int node = (source + sourceCount) / 2; node > 0; node /= 2) {
+            if (beats(tree[node], candidate)) {
+                const int loser = candidate;
+                candidate = tree[node];
+                tree[node] = loser;
+            }
+        }
+        tree[0] = candidate;
+    }
+};
+
+#endif
@@ -3,9 +3,13 @@
 
 #include "../VektorImpl/Vektor.hpp"
 
-template <typename T>
+/**
+ * Binary min-heap on top of Vektor.
+ * AccessPolicy selects checked or unchecked element access of the underlying storage.
+ */
+template <typename T, typename AccessPolicy = DefaultAccessPolicy>
 class MinHeap {
-    Vektor<T> heap;
+    Vektor<T, DoublingGrowth, AccessPolicy> heap;
 
 public:
     MinHeap() {}
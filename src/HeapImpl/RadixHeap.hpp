@@ -0,0 +1,91 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <utility>
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Monotone radix heap of (key, value) pairs with non-negative int keys.
+ * Drop-in for MinHeap<std::pair<int, int>> in Dijkstra: push, top, pop and empty have the same meaning.
+ * Every pushed key must not be smaller than the last minimum removed, which Dijkstra guarantees.
+ * A key goes to bucket b = bit width of (key XOR last minimum), so bucket 0 holds keys equal to the minimum.
+ * When bucket 0 runs empty the lowest non-empty bucket is redistributed around its own minimum; every entry
+ * then moves to a strictly lower bucket, so it is touched at most 32 times in total regardless of key range.
+ */
+class RadixHeap {
+    static constexpr int BUCKETS = 33;
+
+    Vektor<Vektor<std::pair<int, int>>> buckets;
+    unsigned last = 0;
+    int count = 0;
+
+public:
+    static constexpr const char* NAME = "radix heap";
+
+    RadixHeap() : buckets(BUCKETS) {}
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    /**
+     * Not const: an empty bucket 0 is refilled here rather than in pop(), because refilling raises the minimum
+     * above the key just popped, while Dijkstra may still push keys between the two.
+     * Time complexity: O(log C) amortized, C being the key range.
+     */
+    std::pair<int, int> top() {
+        if (buckets[0].empty())
+            redistribute();
+        const Vektor<std::pair<int, int>>& minimum = buckets[0];
+        return minimum[minimum.size() - 1];
+    }
+
+    /**
+     * Time complexity: O(1)
+     */
+    void push(const std::pair<int, int>& entry) {
+        buckets[bucketOf(static_cast<unsigned>(entry.first))].push_back(entry);
+        ++count;
+    }
+
+    /**
+     * Time complexity: O(log C) amortized, C being the key range.
+     */
+    void pop() {
+        if (empty()) return;
+        if (buckets[0].empty())
+            redistribute();
+        Vektor<std::pair<int, int>>& minimum = buckets[0];
+        minimum.removeAt(minimum.size() - 1);
+        --count;
+    }
+
+private:
+    int bucketOf(unsigned key) const {
+        return key == last ? 0 : 32 - __builtin_clz(key ^ last);
+    }
+
+    /// Makes the smallest key of the lowest non-empty bucket the new minimum and spreads that bucket out.
+    void redistribute() {
+        int source = 1;
+        while (buckets[source].empty()) ++source;
+
+        Vektor<std::pair<int, int>>& entries = buckets[source];
+        unsigned smallest = static_cast<unsigned>(entries[0].first);
+        for (int i = 1; i < entries.size(); ++i) {
+            if (static_cast<unsigned>(entries[i].first) < smallest)
+                smallest = static_cast<unsigned>(entries[i].first);
+        }
+        last = smallest;
+        for (int i = 0; i < entries.size(); ++i)
+            buckets[bucketOf(static_cast<unsigned>(entries[i].first))].push_back(entries[i]);
+        entries.clear();
+    }
+};
+
+#endif
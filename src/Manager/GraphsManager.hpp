@@ -3,17 +3,10 @@
 
 #include "../common/GraphRepresentingShape.hpp"
 #include "../FileIO/GraphFileIO.hpp"
-#include "../GraphsImpl/GraphMatrix.hpp"
-#include "../GraphsImpl/GraphList.hpp"
+#include "../GraphsImpl/GraphConcept.hpp"
 #include "../Manager/TimerManager.hpp"
-#include "../GraphsAlgorithms/MSTProblem/PrimList.hpp"
-#include "../GraphsAlgorithms/MSTProblem/PrimMatrix.hpp"
-#include "../GraphsAlgorithms/MSTProblem/KruskalList.hpp"
-#include "../GraphsAlgorithms/MSTProblem/KruskalMatrix.hpp"
-#include "../GraphsAlgorithms/TSPProblem/DijkstraList.hpp"
-#include "../GraphsAlgorithms/TSPProblem/DijkstraMatrix.hpp"
-#include "../GraphsAlgorithms/TSPProblem/FordBellmanList.hpp"
-#include "../GraphsAlgorithms/TSPProblem/FordBellmanMatrix.hpp"
+#include "../MemoryImpl/RunArena.hpp"
+#include "../GraphsAlgorithms/GraphAlgorithms.hpp"
 
 #include <iostream>
 #include <cstring>
@@ -21,6 +14,9 @@
 #include <chrono>
 #include <fstream>
 #include <filesystem>
+#include <optional>
+#include <type_traits>
+#include <variant>
 
 class GraphsManager {
 public:
@@ -54,16 +50,161 @@ public:
         dispatchProblemByShapeBenchmark(problemFlag, algorithmFlag, shape, size, density, repeatCount, outputFile, timestamp);
     }
 
+    /// Counts Vektor allocations of the random graph pipeline and of GraphList construction
+    /// (edge by edge and through GraphBuilder), writes them to a log.
+    static void allocationBenchmarkMode(int size, double density, int repeatCount, const char* outputFile) {
+        std::cout << "[INFO] ALLOCATION BENCHMARK MODE STARTED" << std::endl;
+        std::cout << "[INFO] Graph size: " << size << ", density: " << density << ", repeat count: " << repeatCount << std::endl;
+
+        const std::string timestamp = getCurrentTimestamp();
+        const char* logFile = defaultOut(outputFile, "./benchmark_allocations.txt");
+        RandomGraphGenerator randomGraphGenerator;
+
+        for (int i = 0; i < repeatCount; ++i) {
+            VektorAllocationStats::reset();
+            Vektor<EdgeTriple> edges;
+            const int generationTime = TimerManager::measureTimeMs([&]() {
+                edges = randomGraphGenerator.generateGraphWithDensity(size, density);
+            });
+            const long long generationAllocations = VektorAllocationStats::allocations.load();
+            const long long generationBytes = VektorAllocationStats::bytes.load();
+
+            VektorAllocationStats::reset();
+            std::optional<GraphList> graph;
+            const int constructionTime = TimerManager::measureTimeMs([&]() {
+                graph.emplace(size);
+                for (int e = 0; e < edges.size(); ++e)
+                    graph->addEdge(edges[e].from, edges[e].to, edges[e].weight);
+            });
+            const long long constructionAllocations = VektorAllocationStats::allocations.load();
+            const long long constructionBytes = VektorAllocationStats::bytes.load();
+
+            VektorAllocationStats::reset();
+            const int builderTime = TimerManager::measureTimeMs([&]() {
+                const GraphList builtGraph = GraphBuilder::build<GraphList>(size, edges);
+            });
+            const long long builderAllocations = VektorAllocationStats::allocations.load();
+            const long long builderBytes = VektorAllocationStats::bytes.load();
+
+            std::cout << "[RUN] " << i + 1 << "/" << repeatCount
+                      << " - generator: " << generationAllocations << " allocations, " << generationBytes
+                      << " bytes, " << generationTime << " ms; GraphList: " << constructionAllocations
+                      << " allocations, " << constructionBytes << " bytes, " << constructionTime
+                      << " ms; GraphBuilder: " << builderAllocations << " allocations, " << builderBytes
+                      << " bytes, " << builderTime << " ms" << std::endl;
+
+            GraphIO::appendAllocationEntry(logFile, timestamp, "RandomGraphGenerator", size, edges.size(), i + 1,
+                generationAllocations, generationBytes, generationTime);
+            GraphIO::appendAllocationEntry(logFile, timestamp, "GraphList", size, edges.size(), i + 1,
+                constructionAllocations, constructionBytes, constructionTime);
+            GraphIO::appendAllocationEntry(logFile, timestamp, "GraphBuilder GraphList", size, edges.size(), i + 1,
+                builderAllocations, builderBytes, builderTime);
+        }
+        std::cout << "[INFO] Allocation counts appended to " << logFile << std::endl;
+    }
+
+    /**
+    * Builds the same random graph as GraphList (one Vektor per vertex) and SmallGraphList (inline SmallVektor),
+    * then compares their memory footprint and DijkstraList / FordBellmanList traversal times.
+    */
+    static void adjacencyBenchmarkMode(int size, double density, int repeatCount, const char* outputFile) {
+        std::cout << "[INFO] ADJACENCY CONTAINER BENCHMARK MODE STARTED" << std::endl;
+        std::cout << "[INFO] Graph size: " << size << ", density: " << density << ", repeat count: " << repeatCount << std::endl;
+
+        const std::string timestamp = getCurrentTimestamp();
+        const char* logFile = defaultOut(outputFile, "./benchmark_adjacency.txt");
+        RandomGraphGenerator randomGraphGenerator;
+
+        for (int i = 0; i < repeatCount; ++i) {
+            Vektor<EdgeTriple> edges = randomGraphGenerator.generateGraphWithDensity(size, density);
+            std::cout << "[RUN] " << i + 1 << "/" << repeatCount << std::endl;
+            runAdjacencyBenchmark<GraphList>("GraphList", edges, size, i + 1, logFile, timestamp);
+            runAdjacencyBenchmark<SmallGraphList>("SmallGraphList", edges, size, i + 1, logFile, timestamp);
+        }
+        std::cout << "[INFO] Adjacency results appended to " << logFile << std::endl;
+    }
+
+
+    /**
+    * Runs DijkstraList with its binary heap, Dial bucket queue and radix heap backends on the same random graphs
+    * for every requested density and appends min/max/avg/median times per backend and density to a summary file.
+    */
+    static void queueBenchmarkMode(int size, int repeatCount, const Vektor<double>& densities) {
+        std::cout << "[INFO] DIJKSTRA QUEUE BENCHMARK MODE STARTED" << std::endl;
+        std::cout << "[INFO] Graph size: " << size << ", densities: " << densities.size()
+                  << ", repeat count: " << repeatCount << std::endl;
+
+        const std::string timestamp = getCurrentTimestamp();
+        const char* summaryFile = "./benchmark_dijkstra_queues.txt";
+        RandomGraphGenerator randomGraphGenerator;
+
+        for (int d = 0; d < densities.size(); ++d) {
+            const double density = densities[d];
+            Vektor<int> heapTimes;
+            Vektor<int> dialTimes;
+            Vektor<int> radixTimes;
+            int edgeCount = 0;
+
+            for (int i = 0; i < repeatCount; ++i) {
+                const Vektor<EdgeTriple> edges = randomGraphGenerator.generateGraphWithDensity(size, density);
+                const GraphList graph = GraphBuilder::build<GraphList>(size, edges);
+                edgeCount = graph.getEdgeCount();
+
+                Vektor<EdgeTriple> heapPaths;
+                Vektor<EdgeTriple> dialPaths;
+                Vektor<EdgeTriple> radixPaths;
+                heapTimes.push_back(TimerManager::measureTimeMs([&]() { heapPaths = DijkstraList::findShortestPaths(&graph); }));
+                dialTimes.push_back(TimerManager::measureTimeMs([&]() { dialPaths = DialDijkstraList::findShortestPaths(&graph); }));
+                radixTimes.push_back(TimerManager::measureTimeMs([&]() { radixPaths = RadixDijkstraList::findShortestPaths(&graph); }));
+
+                if (!sameDistances(heapPaths, dialPaths) || !sameDistances(heapPaths, radixPaths))
+                    std::cerr << "[ERROR] Queue backends disagree on shortest path distances" << std::endl;
+
+                std::cout << "[RUN] density " << density << ", " << i + 1 << "/" << repeatCount << " - binary heap: "
+                          << heapTimes[i] << " ms, Dial buckets: " << dialTimes[i] << " ms, radix heap: "
+                          << radixTimes[i] << " ms" << std::endl;
+            }
+
+            appendTimesSummary(summaryFile, timestamp, "Dijkstra (Binary Heap)", LIST, size, edgeCount, density, heapTimes);
+            appendTimesSummary(summaryFile, timestamp, "Dijkstra (Dial Buckets)", LIST, size, edgeCount, density, dialTimes);
+            appendTimesSummary(summaryFile, timestamp, "Dijkstra (Radix Heap)", LIST, size, edgeCount, density, radixTimes);
+        }
+        std::cout << "[INFO] Queue results appended to " << summaryFile << std::endl;
+    }
+
 
 private:
 
-    /// Chooses LIST/MATRIX/BOTH and forwards to file or benchmark dispatch.
+    /// Helper: true if both results reach the same vertices at the same distances (parents may differ on ties).
+    static bool sameDistances(const Vektor<EdgeTriple>& expected, const Vektor<EdgeTriple>& actual) {
+        if (expected.size() != actual.size()) return false;
+        for (int i = 0; i < expected.size(); ++i) {
+            if (expected[i].to != actual[i].to || expected[i].weight != actual[i].weight) return false;
+        }
+        return true;
+    }
+
+    /// Helper: appends min/max/avg/median of one series of times to a graph summary file.
+    static void appendTimesSummary(const char* summaryFile, const std::string& timestamp, const char* name,
+                                   GraphRepresentingShape shape, int size, int edgeCount, double density,
+                                   Vektor<int>& times) {
+        if (times.empty()) return;
+        const int minTime = *std::min_element(times.begin(), times.end());
+        const int maxTime = *std::max_element(times.begin(), times.end());
+        const double avgTime = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+        GraphIO::appendGraphSummaryEntry(summaryFile, timestamp, name, shape, size, edgeCount, density, times.size(),
+            minTime, maxTime, avgTime, SortAlgorithms<int>::median(times));
+    }
+
+    /// Chooses LIST/MATRIX/CSR/DENSE, or all four for BOTH, and forwards to file dispatch.
     static void dispatchProblemByShapeFile(const char* problemFlag, const char* algorithmFlag, int src, int dst,
                                     const GraphRepresentingShape shape, const std::string& inputFile,
                                     const char* outputFile, const std::string& timestamp) {
         if (shape == BOTH) {
             dispatchProblemByAlgorithmFile(problemFlag, algorithmFlag, src, dst, MATRIX, inputFile, outputFile, timestamp);
             dispatchProblemByAlgorithmFile(problemFlag, algorithmFlag, src, dst, LIST, inputFile, outputFile, timestamp);
+            dispatchProblemByAlgorithmFile(problemFlag, algorithmFlag, src, dst, CSR, inputFile, outputFile, timestamp);
+            dispatchProblemByAlgorithmFile(problemFlag, algorithmFlag, src, dst, DENSE, inputFile, outputFile, timestamp);
         } else {
             dispatchProblemByAlgorithmFile(problemFlag, algorithmFlag, src, dst, shape, inputFile, outputFile, timestamp);
         }
@@ -73,24 +214,19 @@ private:
     static void dispatchProblemByAlgorithmFile(const char* problem, const char* algorithm, int src, int dst,
                                         const GraphRepresentingShape shape, const std::string& inputFile,
                                         const char* outputFile, const std::string& timestamp) {
-        IGraph* baseGraph = GraphIO::readGraph(inputFile, shape);
+        std::optional<AnyGraph> baseGraph = GraphIO::readGraph(inputFile, shape);
         if (!baseGraph) {
             std::cerr << "[ERROR] Graph could not be read." << std::endl;
             return;
         }
-        baseGraph->display();
-
-        if (std::strcmp(problem, "--mst") == 0)
-            dispatchMST(algorithm, shape, baseGraph, outputFile, timestamp);
-        else if (std::strcmp(problem, "--tsp") == 0)
-            dispatchTSP(src, dst, algorithm, shape, baseGraph, outputFile, timestamp);
-        else
-            std::cerr << "[ERROR] Unknown problem type: " << problem << std::endl;
 
-        delete baseGraph;
+        std::visit([&](const auto& graph) {
+            graph.display();
+            dispatchProblem(problem, algorithm, src, dst, graph, outputFile, timestamp);
+        }, *baseGraph);
     }
 
-    /// Chooses LIST/MATRIX/BOTH and forwards to benchmark dispatch.
+    /// Chooses LIST/MATRIX/CSR/DENSE, or all four for BOTH, and forwards to benchmark dispatch.
     static void dispatchProblemByShapeBenchmark(const char* problemFlag, const char* algorithmFlag,
                                     const GraphRepresentingShape shape, int size, double density, int repeatCount,
                                     const char* outputFile, const std::string& timestamp) {
@@ -99,49 +235,69 @@ private:
                 outputFile, timestamp);
             dispatchProblemByAlgorithmBenchmark(problemFlag, algorithmFlag, LIST, size, density, repeatCount,
                 outputFile, timestamp);
+            dispatchProblemByAlgorithmBenchmark(problemFlag, algorithmFlag, CSR, size, density, repeatCount,
+                outputFile, timestamp);
+            dispatchProblemByAlgorithmBenchmark(problemFlag, algorithmFlag, DENSE, size, density, repeatCount,
+                outputFile, timestamp);
         } else {
             dispatchProblemByAlgorithmBenchmark(problemFlag, algorithmFlag, shape, size, density, repeatCount,
                 outputFile, timestamp);
         }
     }
 
-    /// Generates random graphs, runs MST/TSP per repeat, collects all times, writes summary.
+    /**
+    * Generates random graphs, runs MST/TSP per repeat, collects all times, writes summary.
+    * Every repetition allocates its graph and algorithm temporaries from a per-run arena
+    * that is reset afterwards, so only the first repetition should need heap memory.
+    */
     static void dispatchProblemByAlgorithmBenchmark(const char* problem, const char* algorithm,
                                           const GraphRepresentingShape shape, int size, double density, int repeatCount,
                                           const char* outputFile, const std::string& timestamp) {
         Vektor<int> allTimes;
+        Vektor<int> generationTimes;
+        Vektor<int> constructionTimes;
+        allTimes.reserve(2 * repeatCount);
         RandomGraphGenerator randomGraphGenerator;
+        RunArena runArena;
 
         for (int i = 0; i < repeatCount; ++i) {
-            IGraph* baseGraph = randomGraphGenerator.generateGraphInStructure(size, density, shape);
-            if (!baseGraph) {
-                std::cerr << "[ERROR] Error generating random graph." << std::endl;
-                return;
+            {
+                ScopedRunArena arenaScope(runArena);
+                Vektor<EdgeTriple> edges;
+                const int generationTime = TimerManager::measureTimeMs([&]() {
+                    edges = randomGraphGenerator.generateGraphWithDensity(size, density);
+                });
+                std::optional<AnyGraph> baseGraph;
+                const int constructionTime = TimerManager::measureTimeMs([&]() {
+                    baseGraph = createGraphInstance(shape, size, edges);
+                });
+                if (!baseGraph) {
+                    std::cerr << "[ERROR] Error generating random graph." << std::endl;
+                    return;
+                }
+                generationTimes.push_back(generationTime);
+                constructionTimes.push_back(constructionTime);
+                std::cout << "[INFO] Graph generation time: " << generationTime << " ms, construction time: "
+                          << constructionTime << " ms" << std::endl;
+
+                std::cout << "[RUN] " << i + 1 << "/" << repeatCount << " - ";
+                const Vektor<int> execTimes = std::visit([&](const auto& graph) {
+                    graph.display();
+                    return dispatchProblem(problem, algorithm, 0, -1, graph, outputFile, timestamp);
+                }, *baseGraph);
+
+                allTimes.insertEnd(execTimes.begin(), execTimes.end());
             }
-
-            std::cout << "[RUN] " << i + 1 << "/" << repeatCount << " - ";
-            baseGraph->display();
-
-            Vektor<int> execTimes;
-            if (std::strcmp(problem, "--mst") == 0)
-                execTimes = dispatchMST(algorithm, shape, baseGraph, outputFile, timestamp);
-            else if (std::strcmp(problem, "--tsp") == 0)
-                execTimes = dispatchTSP(0, -1, algorithm, shape, baseGraph, outputFile, timestamp);
-            else
-                std::cerr << "[ERROR] Unknown problem type: " << problem << std::endl;
-
-            allTimes.insertEnd(execTimes.begin(), execTimes.end());
-            delete baseGraph;
+            const long long heapAllocations = runArena.reset();
+            std::cout << "[ARENA] Run " << i + 1 << " heap allocations beyond arena: " << heapAllocations
+                      << ", arena size: " << runArena.getBufferSize() << " bytes" << std::endl;
         }
 
         if (!allTimes.empty()) {
             int minTime = *std::min_element(allTimes.begin(), allTimes.end());
             int maxTime = *std::max_element(allTimes.begin(), allTimes.end());
             double avgTime = std::accumulate(allTimes.begin(), allTimes.end(), 0.0) / allTimes.size();
-            SortAlgorithms<int>::quickSort(allTimes);
-            double median = allTimes.size() % 2 == 0
-                            ? (allTimes[allTimes.size() / 2 - 1] + allTimes[allTimes.size() / 2]) / 2.0
-                            : allTimes[allTimes.size() / 2];
+            double median = SortAlgorithms<int>::median(allTimes);
             const double maxPossibleEdges =  static_cast<int>(size * (size - 1) * density / 200.0);
 
             GraphIO::appendGraphSummaryEntry(
@@ -159,96 +315,169 @@ private:
                 median
             );
         }
+        // Generator and construction times get rows of their own, in the same layout as the algorithm row.
+        const int expectedEdges = static_cast<int>(size * (size - 1) * density / 200.0);
+        appendTimesSummary("./benchmark_summary.txt", timestamp, "Random Graph Generator", shape, size, expectedEdges,
+            density, generationTimes);
+        appendTimesSummary("./benchmark_summary.txt", timestamp, "Graph Construction", shape, size, expectedEdges,
+            density, constructionTimes);
+    }
+
+    /// Invokes MST or TSP dispatch for one concrete representation, returns vector of execution times.
+    template <GraphRepresentation G>
+    static Vektor<int> dispatchProblem(const char* problem, const char* algorithm, int src, int dst, const G& g,
+                                       const char* outputFile, const std::string& timestamp) {
+        if (std::strcmp(problem, "--mst") == 0)
+            return dispatchMST(algorithm, g, outputFile, timestamp);
+        if (std::strcmp(problem, "--tsp") == 0)
+            return dispatchTSP(src, dst, algorithm, g, outputFile, timestamp);
+
+        std::cerr << "[ERROR] Unknown problem type: " << problem << std::endl;
+        return {};
     }
 
     /// Runs the requested MST variants on one graph, logs each, returns vector of execution times.
-    static Vektor<int> dispatchMST(const char* algorithm, GraphRepresentingShape shape, IGraph* g,
-                                    const char* outputFile, const std::string& timestamp) {
+    template <GraphRepresentation G>
+    static Vektor<int> dispatchMST(const char* algorithm, const G& g, const char* outputFile,
+                                   const std::string& timestamp) {
+        using Algorithms = GraphAlgorithms<G>;
+        const bool all = std::strcmp(algorithm, "--all") == 0;
         Vektor<int> times;
-        if (std::strcmp(algorithm, "--all") == 0) {
-            if (shape == LIST) {
-                times.push_back(runAndLogMST<GraphList,  PrimList>(dynamic_cast<GraphList*>(g), "Prim",
-                    defaultOut(outputFile, "./historyPrim.txt"), timestamp));
-                times.push_back(runAndLogMST<GraphList,  KruskalList>(dynamic_cast<GraphList*>(g), "Kruskal",
-                    defaultOut(outputFile, "./historyKruskal.txt"), timestamp));
+
+        if (all || std::strcmp(algorithm, "--prim") == 0) {
+            times.push_back(runAndLogMST<G, typename Algorithms::Prim>(&g, "Prim",
+                defaultOut(outputFile, "./historyPrim.txt"), timestamp));
+        }
+        if (all || std::strcmp(algorithm, "--primheap") == 0) {
+            if constexpr (std::is_void_v<typename Algorithms::PrimHeap>) {
+                if (!all) reportMissingVariant<G>("Heap-based Prim");
             } else {
-                times.push_back(runAndLogMST<GraphMatrix, PrimMatrix>(dynamic_cast<GraphMatrix*>(g), "Prim",
-                   defaultOut(outputFile, "./historyPrim.txt"), timestamp));
-                times.push_back(runAndLogMST<GraphMatrix,  KruskalMatrix>(dynamic_cast<GraphMatrix*>(g), "Kruskal",
-                    defaultOut(outputFile, "./historyKruskal.txt"), timestamp));
+                times.push_back(runAndLogMST<G, typename Algorithms::PrimHeap>(&g, "PrimHeap",
+                    defaultOut(outputFile, "./historyPrimHeap.txt"), timestamp));
             }
         }
-        if (std::strcmp(algorithm, "--prim") == 0) {
-            if (shape == LIST)
-                times.push_back(runAndLogMST<GraphList,  PrimList>(dynamic_cast<GraphList*>(g), "Prim",
-                   defaultOut(outputFile, "./historyPrim.txt"), timestamp));
-            else
-                times.push_back(runAndLogMST<GraphMatrix,  PrimMatrix>(dynamic_cast<GraphMatrix*>(g), "Prim",
-                   defaultOut(outputFile, "./historyPrim.txt"), timestamp));
-        }
-        if (std::strcmp(algorithm, "--krus") == 0) {
-            if (shape == LIST)
-                times.push_back(runAndLogMST<GraphList,  KruskalList>(dynamic_cast<GraphList*>(g), "Kruskal",
-                   defaultOut(outputFile, "./historyKruskal.txt"), timestamp));
-            else
-                times.push_back(runAndLogMST<GraphMatrix,  KruskalMatrix>(dynamic_cast<GraphMatrix*>(g), "Kruskal",
+        if (all || std::strcmp(algorithm, "--krus") == 0) {
+            if constexpr (std::is_void_v<typename Algorithms::Kruskal>) {
+                if (!all) reportMissingVariant<G>("Kruskal");
+            } else {
+                times.push_back(runAndLogMST<G, typename Algorithms::Kruskal>(&g, "Kruskal",
                     defaultOut(outputFile, "./historyKruskal.txt"), timestamp));
+            }
         }
 
         return times;
     }
 
-    /// Executes one MST algorithm, logs to history, returns the execution time in ms.
-    static Vektor<int> dispatchTSP(int src, int dest, const char* algorithm, GraphRepresentingShape shape, IGraph* g,
-                                                            const char* outputFile, const std::string& timestamp) {
+    /// Runs the requested shortest-path variants (src→dest) on one graph, logs each, returns execution times.
+    template <GraphRepresentation G>
+    static Vektor<int> dispatchTSP(int src, int dest, const char* algorithm, const G& g, const char* outputFile,
+                                   const std::string& timestamp) {
+        using Algorithms = GraphAlgorithms<G>;
+        const bool all = std::strcmp(algorithm, "--all") == 0;
         Vektor<int> times;
-        if (std::strcmp(algorithm, "--all") == 0) {
-            if (shape == LIST) {
-                 times.push_back(runAndLogTSP<GraphList,   DijkstraList>(dynamic_cast<GraphList*>(g),
-                     src, dest, "Dijkstra",
-                     defaultOut(outputFile, "./historyDijkstra.txt"), timestamp));
-                 times.push_back(runAndLogTSP<GraphList,   FordBellmanList>(dynamic_cast<GraphList*>(g),
-                     src, dest, "FordBellman",
-                     defaultOut(outputFile, "./historyFordBellman.txt"), timestamp));
+
+        if (all || std::strcmp(algorithm, "--dij") == 0) {
+            times.push_back(runAndLogTSP<G, typename Algorithms::Dijkstra>(&g, src, dest, "Dijkstra",
+                defaultOut(outputFile, "./historyDijkstra.txt"), timestamp));
+        }
+        if (all || std::strcmp(algorithm, "--dijdial") == 0) {
+            if constexpr (std::is_void_v<typename Algorithms::DijkstraDial>) {
+                if (!all) reportMissingVariant<G>("Dial's Dijkstra");
+            } else {
+                times.push_back(runAndLogTSP<G, typename Algorithms::DijkstraDial>(&g, src, dest, "DijkstraDial",
+                    defaultOut(outputFile, "./historyDijkstraDial.txt"), timestamp));
             }
-            else {
-                times.push_back(runAndLogTSP<GraphMatrix,   DijkstraMatrix>(dynamic_cast<GraphMatrix*>(g),
-                    src, dest, "Dijkstra",
-                    defaultOut(outputFile, "./historyDijkstra.txt"), timestamp));
-                times.push_back(runAndLogTSP<GraphMatrix,   FordBellmanMatrix>(dynamic_cast<GraphMatrix*>(g),
-                    src, dest, "FordBellman",
+        }
+        if (all || std::strcmp(algorithm, "--dijradix") == 0) {
+            if constexpr (std::is_void_v<typename Algorithms::DijkstraRadix>) {
+                if (!all) reportMissingVariant<G>("Radix heap Dijkstra");
+            } else {
+                times.push_back(runAndLogTSP<G, typename Algorithms::DijkstraRadix>(&g, src, dest, "DijkstraRadix",
+                    defaultOut(outputFile, "./historyDijkstraRadix.txt"), timestamp));
+            }
+        }
+        if (all || std::strcmp(algorithm, "--ford") == 0) {
+            if constexpr (std::is_void_v<typename Algorithms::FordBellman>) {
+                if (!all) reportMissingVariant<G>("Ford-Bellman");
+            } else {
+                times.push_back(runAndLogTSP<G, typename Algorithms::FordBellman>(&g, src, dest, "FordBellman",
                     defaultOut(outputFile, "./historyFordBellman.txt"), timestamp));
             }
         }
 
-        if (std::strcmp(algorithm, "--dij") == 0) {
-            if (shape == LIST)
-                times.push_back(runAndLogTSP<GraphList,   DijkstraList>(dynamic_cast<GraphList*>(g),
-                    src, dest, "Dijkstra",
-                    defaultOut(outputFile, "./historyDijkstra.txt"), timestamp));
-            else
-                times.push_back(runAndLogTSP<GraphMatrix,   DijkstraMatrix>(dynamic_cast<GraphMatrix*>(g),
-                    src, dest, "Dijkstra",
-                    defaultOut(outputFile, "./historyDijkstra.txt"), timestamp));
-        }else if (std::strcmp(algorithm, "--ford") == 0 ) {
-            if (shape == LIST)
-                times.push_back(runAndLogTSP<GraphList,   FordBellmanList>(dynamic_cast<GraphList*>(g),
-                   src, dest, "FordBellman",
-                   defaultOut(outputFile, "./historyFordBellman.txt"), timestamp));
-            else
-                times.push_back(runAndLogTSP<GraphMatrix,   FordBellmanMatrix>(dynamic_cast<GraphMatrix*>(g),
-                   src, dest, "FordBellman",
-                   defaultOut(outputFile, "./historyFordBellman.txt"), timestamp));
-        }
         return times;
     }
 
+    /// Helper: reports an algorithm that has no implementation for representation G.
+    template <GraphRepresentation G>
+    static void reportMissingVariant(const char* algorithmName) {
+        std::cerr << "[ERROR] " << algorithmName << " is not implemented for the "
+                  << getShapeName(getShape<G>()) << " representation" << std::endl;
+    }
+
+    /// Builds one adjacency-list flavour from edges, logs its memory footprint and traversal times.
+    template <typename G>
+    static void runAdjacencyBenchmark(const std::string& graphName, const Vektor<EdgeTriple>& edges, int size,
+                                      int repetition, const char* logFile, const std::string& timestamp) {
+        VektorAllocationStats::reset();
+        G graph(size);
+        for (int e = 0; e < edges.size(); ++e)
+            graph.addEdge(edges[e].from, edges[e].to, edges[e].weight);
+        const long long allocations = VektorAllocationStats::allocations.load();
+        const long long allocatedBytes = VektorAllocationStats::bytes.load();
+        const long long residentBytes = residentAdjacencyBytes(graph, size);
+
+        const int dijkstraTime = TimerManager::measureTimeMs([&]() { DijkstraList::findShortestPaths(&graph); });
+        const int fordTime = TimerManager::measureTimeMs([&]() { FordBellmanList::findShortestPaths(&graph); });
+
+        std::cout << "[" << graphName << "] " << allocations << " allocations, " << allocatedBytes
+                  << " bytes allocated, " << residentBytes << " bytes resident; Dijkstra: " << dijkstraTime
+                  << " ms, FordBellman: " << fordTime << " ms" << std::endl;
+
+        // The construction row carries allocation traffic (every growth step counted); the footprint row what stays allocated.
+        GraphIO::appendAllocationEntry(logFile, timestamp, graphName + " construction", size, edges.size(),
+            repetition, allocations, allocatedBytes, 0);
+        GraphIO::appendAllocationEntry(logFile, timestamp, graphName + " resident footprint", size, edges.size(),
+            repetition, 0, residentBytes, 0);
+        GraphIO::appendAllocationEntry(logFile, timestamp, graphName + " DijkstraList", size, edges.size(),
+            repetition, 0, 0, dijkstraTime);
+        GraphIO::appendAllocationEntry(logFile, timestamp, graphName + " FordBellmanList", size, edges.size(),
+            repetition, 0, 0, fordTime);
+    }
+
+    /**
+     * Bytes the adjacency list holds once built: the per-vertex container array plus the final heap buffer
+     * of every list that has one (a SmallVektor still using its inline slots owns none).
+     * Time complexity: O(V)
+     */
+    template <typename G>
+    static long long residentAdjacencyBytes(const G& graph, int size) {
+        using Container = std::remove_cvref_t<decltype(graph.getNeighbors(0))>;
+        long long bytes = static_cast<long long>(sizeof(Container)) * size;
+        for (int v = 0; v < size; ++v) {
+            const Container& neighbors = graph.getNeighbors(v);
+            if constexpr (requires { neighbors.isInline(); }) {
+                if (neighbors.isInline()) continue;
+            }
+            bytes += static_cast<long long>(neighbors.getCapacity()) * sizeof(Edge);
+        }
+        return bytes;
+    }
+
     /// Executes one TSP algorithm (src→dest), logs to history, returns the execution time in ms.
     template<typename G, typename Algo>
-    static int runAndLogMST(G* g, const std::string& algoName, const std::string& historyFile, const std::string& ts)
+    static int runAndLogMST(const G* g, const std::string& algoName, const std::string& historyFile, const std::string& ts)
     {
         auto result = Algo::findMST(g);
-        int execTime = TimerManager::measureTimeMs([&]() { Algo::findMST(g); });
+        const int execTime = TimerManager::measureTimeMs([&]() { Algo::findMST(g); });
+        if constexpr (requires { Algo::extractEdges(g); }) {
+            // Kruskal's edge extraction is timed in a run of its own, so execTime stays one uninterrupted measurement.
+            const int extractionTime = TimerManager::measureTimeMs([&]() { Algo::extractEdges(g); });
+            std::cout << "[INFO] " << algoName << " edge extraction time (separate run): " << extractionTime
+                      << " ms, full run: " << execTime << " ms" << std::endl;
+            GraphIO::appendGraphHistoryEntry(historyFile, ts, algoName + " edge extraction", getShape<G>(),
+                g->getVertexCount(), g->getEdgeCount(), extractionTime, 0, "", "");
+        }
         Algo::displayMST(result);
         GraphIO::appendGraphHistoryEntry(
           historyFile,
@@ -267,7 +496,7 @@ private:
 
     /// Executes one TSP algorithm (src→dest), logs to history, returns the execution time in ms.
     template<typename G, typename Algo>
-    static int runAndLogTSP(G* g, int src, int dst, const std::string& algoName, const std::string& historyFile,
+    static int runAndLogTSP(const G* g, int src, int dst, const std::string& algoName, const std::string& historyFile,
      const std::string& ts)
     {
         auto result = Algo::findShortestPaths(g, src, dst);
@@ -288,10 +517,12 @@ private:
         return execTime;
     }
 
-    /// Generic type→LIST/MATRIX resolver used by runAndLog….
+    /// Generic type→LIST/MATRIX/CSR/DENSE resolver used by runAndLog….
     template <typename G>
     static GraphRepresentingShape getShape() {
-        if constexpr (std::is_same_v<G, GraphList*> || std::is_same_v<G, GraphList>) return LIST;
+        if constexpr (std::is_same_v<G, GraphList>) return LIST;
+        else if constexpr (std::is_same_v<G, GraphCSR>) return CSR;
+        else if constexpr (std::is_same_v<G, GraphDense>) return DENSE;
         else return MATRIX;
     }
 
@@ -318,12 +549,16 @@ private:
         return (std::strcmp(provided, "") == 0) ? fallback : provided;
     }
 
-    /// Helper: returns LIST or MATRIX based on shape flag string.
+    /// Helper: returns LIST, MATRIX, CSR or DENSE based on shape flag string.
     static GraphRepresentingShape getShapeFlag(const char* shapeStr) {
         if (std::strcmp(shapeStr, "--list") == 0)
             return LIST;
         if (std::strcmp(shapeStr,"--matrix") == 0)
             return MATRIX;
+        if (std::strcmp(shapeStr, "--csr") == 0)
+            return CSR;
+        if (std::strcmp(shapeStr, "--dense") == 0)
+            return DENSE;
         if (std::strcmp(shapeStr, "--all") == 0)
             return BOTH;
 
@@ -331,14 +566,18 @@ private:
         std::exit(EXIT_FAILURE);
     }
 
-    /// Helper: returns 'List' or 'Matrix' based on shape flag string.
+    /// Helper: returns 'List', 'Matrix', 'CSR' or 'Dense Matrix' based on shape flag string.
     static const char* getShapeDisplayName(const char* shapeStr) {
         if (std::strcmp(shapeStr, "--list") == 0)
             return "List";
         if (std::strcmp(shapeStr,"--matrix") == 0)
             return "Matrix";
+        if (std::strcmp(shapeStr, "--csr") == 0)
+            return "CSR";
+        if (std::strcmp(shapeStr, "--dense") == 0)
+            return "Dense Matrix";
         if (std::strcmp(shapeStr, "--all") == 0)
-            return "Both List and Matrix Representations";
+            return "List, Matrix, CSR and Dense Representations";
 
         std::cerr << "[ERROR] Unknown shape flag: " << shapeStr << std::endl;
         std::exit(EXIT_FAILURE);
@@ -348,10 +587,16 @@ private:
     static const char* getAlgorithmDisplayName(const char* algFlag) {
         if (std::strcmp(algFlag, "--prim") == 0)
             return "Prim";
+        if (std::strcmp(algFlag, "--primheap") == 0)
+            return "Prim (Indexed Heap)";
         if (std::strcmp(algFlag, "--krus") == 0)
             return "Kruskal";
         if (std::strcmp(algFlag, "--dij") == 0)
             return "Dijkstra";
+        if (std::strcmp(algFlag, "--dijdial") == 0)
+            return "Dijkstra (Dial Buckets)";
+        if (std::strcmp(algFlag, "--dijradix") == 0)
+            return "Dijkstra (Radix Heap)";
         if (std::strcmp(algFlag, "--ford") == 0)
             return "Ford-Bellman";
         if (std::strcmp(algFlag, "--all") == 0)
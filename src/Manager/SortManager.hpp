@@ -4,18 +4,31 @@
 #include "../VektorImpl/Vektor.hpp"
 #include "../RandomGenerator/RandomNumbersToSortGenerator.hpp"
 #include "../SortAlgorithms/SortAlgorithms.hpp"
+#include "../SortAlgorithms/ParallelSortAlgorithms.hpp"
+#include "../ThreadPoolImpl/WorkStealingPool.hpp"
 #include "../SortAlgorithms/AlgorithmsUtils.hpp"
 #include "../FileIO/FileIO.hpp"
+#include "../FileIO/ExternalMergeSort.hpp"
 #include "TimerManager.hpp"
 #include <iostream>
 #include <cstring>
 #include <cstdlib>
 #include <chrono>
+#include <cmath>
 #include <fstream>
 #include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <memory>
+#include <thread>
 
 class SortManager {
 public:
+    /// Sets the number of threads used by the parallel algorithms (--threads N).
+    static void setThreadCount(int threads) {
+        threadCount = threads < 1 ? 1 : threads;
+    }
+
     /// Reads data from an input file, sorts it with the given algorithm, and writes the result to an output file.
     template <typename T>
     static void fileInputMode(const char* algFlag, const char* inputFile, const char* outputFile) {
@@ -29,6 +42,7 @@ public:
         std::cout << "Chosen data type: " << getDataTypeName<T>() << std::endl;
         std::cout << "Data read from file with" << size << " elements." << std::endl;
 
+        warmPool(algFlag);
         const int sortingTime = TimerManager::measureTimeMs( [&]() {
             sortUsingAlgorithm<T>(data, algFlag);
         });
@@ -39,6 +53,33 @@ public:
         FileIO<T>::writeSortedData(data, outputFile);
     }
 
+    /**
+    * Sorts an input file that may be larger than memory: chunks of memoryMB are sorted with the chosen
+    * algorithm, spilled as runs to temporary files and merged fanIn at a time with a loser tree.
+    */
+    template <typename T>
+    static void externalSortMode(const char* algFlag, const char* inputFile, const char* outputFile,
+                                 double memoryMB, int fanIn) {
+        std::cout << "Chosen algorithm: " << getAlgorithmName(algFlag) << std::endl;
+        std::cout << "Chosen data type: " << getDataTypeName<T>() << std::endl;
+        std::cout << "Memory budget: " << memoryMB << " MB, fan-in: " << fanIn << std::endl;
+
+        ExternalSortStats stats;
+        const long long budgetBytes = static_cast<long long>(memoryMB * 1024.0 * 1024.0);
+        const bool ok = ExternalMergeSort<T>::sort(inputFile, outputFile, budgetBytes, fanIn,
+            [&](Vektor<T>& chunk) { sortUsingAlgorithm<T>(chunk, algFlag); }, stats);
+        if (!ok) {
+            std::cerr << "[ERROR] External sort failed." << std::endl;
+            return;
+        }
+
+        std::cout << "Sorted " << stats.elements << " elements in " << stats.runs << " runs with "
+                  << stats.mergePasses << " merge passes." << std::endl;
+        std::cout << "I/O time = " << stats.ioMs << " milliseconds, CPU time = " << stats.cpuMs
+                  << " milliseconds, Total = " << stats.ioMs + stats.cpuMs << " milliseconds." << std::endl;
+        std::cout << "Sorted data written to " << outputFile << std::endl;
+    }
+
     /// Generates random data of specified size and range, sorts it, and outputs the result.
     template <typename T>
     static void benchmarkMode(const char* algFlag, int data_length, T minVal, T maxVal, const char* outputFile) {
@@ -48,13 +89,16 @@ public:
         std::cout << "Chosen data type: " << getDataTypeName<T>() << std::endl;
         std::cout << "Data generated with " << data_length << " elements." << std::endl;
 
+        PerfCounters counters;
+        warmPool(algFlag);
         const int sortingTime = TimerManager::measureTimeMs( [&]() {
             sortUsingAlgorithm<T>(data, algFlag);
-        });
+        }, counters);
         const bool isSorted = AlgorithmsUtils<T>::isSorted(data);
 
         std::cout << "Sorted = " << (isSorted ? "Yes" : "No")
                   << ", Time = " << sortingTime << " milliseconds." << std::endl;
+        printCounters(counters);
         FileIO<T>::writeSortedData(data, outputFile);
     }
 
@@ -68,11 +112,7 @@ public:
 
         bool writeSorted = (std::strcmp(writeFlag, "--t") == 0);
 
-        auto now= std::chrono::system_clock::now();
-        auto in_time= std::chrono::system_clock::to_time_t(now);
-        std::ostringstream ts;
-        ts << std::put_time(std::localtime(&in_time), "%Y.%m.%d_%H-%M-%S");
-        std::string timestamp = ts.str();
+        std::string timestamp = currentTimestamp();
 
         std::string histName = std::string("benchmark_series_history_") + getAlgorithmName(algFlag) + ".txt";
         std::string summaryName   = std::string("benchmark_summary_history_") + getAlgorithmName(algFlag) + ".txt";
@@ -84,15 +124,18 @@ public:
         }
 
         Vektor<int> times;
+        PerfCounters counters;
+        warmPool(algFlag);
         for (int i = 0; i < repeatCount; ++i) {
             Vektor<T> data = selectDataByMode<T>(dataModeFlag, data_length, minVal, maxVal);
             int t = TimerManager::measureTimeMs([&](){
                 SortManager::sortUsingAlgorithm<T>(data, algFlag);
-            });
+            }, counters);
             const bool isSorted = AlgorithmsUtils<T>::isSorted(data);
 
             std::cout << "Sorted = " << (isSorted ? "Yes" : "No")
                       << ", Time = " << t << " milliseconds." << std::endl;
+            printCounters(counters);
             times.push_back(t);
             if (writeSorted) {
                 std::string sortedDataFileName = sortedFolder + "/" + std::to_string(i) + ".txt";
@@ -110,22 +153,9 @@ public:
             );
         }
 
-        int minTime = times[0];
-        int maxTime = times[0];
-        long long sum = 0;
-        for (int i = 0; i < times.size(); ++i) {
-            int v = times[i];
-            sum += v;
-            if (v < minTime) minTime = v;
-            if (v > maxTime) maxTime = v;
-        }
-        double average = double(sum) / repeatCount;
-
-        SortAlgorithms<int>::quickSort(times);
-        double median = (repeatCount % 2 == 0)
-                      ? (times[repeatCount/2 - 1] + times[repeatCount/2]) / 2.0
-                      : times[repeatCount/2];
-
+        int minTime, maxTime;
+        double average, median;
+        summarizeTimes(times, minTime, maxTime, average, median);
 
         FileIO<T>::appendSummaryEntry(
          summaryName,
@@ -150,11 +180,14 @@ public:
             std::cout << "Sorted data files in folder: " << sortedFolder << std::endl;
     }
 
-    /// Runs series of benchmarks varying the input size using the same algorithm and write options.
+    /**
+    * Runs series of benchmarks varying the input size using the same algorithm and write options.
+    * Algorithms that are not quadratic additionally run on the large sizes.
+    */
     template<typename T>
     static void studyVarySizes(const char* algFlag, int repeatCount, const char* writeFlag, const char* outputFile)
     {
-        int sizes[] = {10000,20000,30000, 40000, 50000, 80000, 160000};
+        int sizes[] = {10000,20000,30000, 40000, 50000, 80000, 160000, 320000, 640000, 1280000};
         T fullMin, fullMax;
         if constexpr (std::is_integral_v<T>) {
             fullMin = std::numeric_limits<T>::lowest();
@@ -164,15 +197,19 @@ public:
             fullMax = T(1000);
         }
         for (int sz : sizes) {
-            serialBenchmark<T>(
-                algFlag,
-                sz,
-                fullMin,
-                fullMax,
-                repeatCount,
-                outputFile,
-                writeFlag
-            );
+            forEachAlgorithmFlag(algFlag, [&](const char* flag) {
+                if (sz > 160000 && isQuadratic(flag))
+                    return;
+                serialBenchmark<T>(
+                    flag,
+                    sz,
+                    fullMin,
+                    fullMax,
+                    repeatCount,
+                    outputFile,
+                    writeFlag
+                );
+            });
         }
     }
 
@@ -181,26 +218,28 @@ public:
     static void studyVaryDistributions(const char* algFlag, int dataLength, int repeatCount, const char* writeFlag,
         const char* outputFile)
     {
-        const char* distModes[] = {"--rand","--asc","--desc","--33","--66"};
+        const char* distModes[] = {"--rand","--asc","--desc","--33","--66","--few"};
         T fullMin = std::numeric_limits<T>::lowest();
         T fullMax = std::numeric_limits<T>::max();
         for (auto d : distModes) {
             std::cout << "[Study2] Mode = " << d << std::endl;
-            try {
-                serialBenchmark<T>(
-                    algFlag,
-                    dataLength,
-                    fullMin,
-                    fullMax,
-                    repeatCount,
-                    outputFile,
-                    writeFlag,
-                    d
-                );
-            }
-            catch (const std::exception &e) {
-                std::cerr << "Error for " << d << ": " << e.what() << std::endl;
-            }
+            forEachAlgorithmFlag(algFlag, [&](const char* flag) {
+                try {
+                    serialBenchmark<T>(
+                        flag,
+                        dataLength,
+                        fullMin,
+                        fullMax,
+                        repeatCount,
+                        outputFile,
+                        writeFlag,
+                        d
+                    );
+                }
+                catch (const std::exception &e) {
+                    std::cerr << "Error for " << d << ": " << e.what() << std::endl;
+                }
+            });
         }
     }
 
@@ -212,7 +251,288 @@ public:
         studyVarySizes<double>(algFlag, repeatCount, writeFlag, outputFile);
     }
 
+    /**
+    * Sorts identical random data with the four classic algorithms twice: once through a Vektor with
+    * checked operator[] and once with unchecked access. Prints both timings and writes one summary row per mode.
+    */
+    template <typename T>
+    static void accessPolicyBenchmark(int dataLength, int repeatCount, T minVal, T maxVal) {
+        const char* algorithms[] = {"--is", "--bi", "--hs", "--qs"};
+        const std::string timestamp = currentTimestamp();
+        const std::string summaryName = "benchmark_summary_history_access_policy.txt";
+
+        for (auto algFlag : algorithms) {
+            Vektor<int> checkedTimes;
+            Vektor<int> uncheckedTimes;
+            for (int i = 0; i < repeatCount; ++i) {
+                Vektor<T> source = RandomNumbersToSortGenerator::generateDataToSort<T>(dataLength, minVal, maxVal);
+                Vektor<T, DoublingGrowth, CheckedAccess> checkedData;
+                Vektor<T, DoublingGrowth, UncheckedAccess> uncheckedData;
+                checkedData.insertEnd(source.begin(), source.end());
+                uncheckedData.insertEnd(source.begin(), source.end());
+
+                checkedTimes.push_back(TimerManager::measureTimeMs([&]() {
+                    sortUsingAlgorithm<T>(checkedData, algFlag);
+                }));
+                uncheckedTimes.push_back(TimerManager::measureTimeMs([&]() {
+                    sortUsingAlgorithm<T>(uncheckedData, algFlag);
+                }));
+
+                const bool isSorted = AlgorithmsUtils<T>::isSorted(checkedData) && AlgorithmsUtils<T>::isSorted(uncheckedData);
+                std::cout << getAlgorithmName(algFlag) << " run " << i + 1 << ": Sorted = " << (isSorted ? "Yes" : "No")
+                          << ", Checked = " << checkedTimes[i] << " ms, Unchecked = " << uncheckedTimes[i]
+                          << " ms." << std::endl;
+            }
+
+            int minTime, maxTime;
+            double checkedAverage, uncheckedAverage, median;
+            summarizeTimes(checkedTimes, minTime, maxTime, checkedAverage, median);
+            FileIO<T>::appendSummaryEntry(summaryName, timestamp, dataLength, getSortingOrderName("--rand"),
+                (std::string(getAlgorithmName(algFlag)) + " [Checked]").c_str(), getDataTypeName<T>(), repeatCount,
+                minTime, maxTime, checkedAverage, median, minVal, maxVal);
+            summarizeTimes(uncheckedTimes, minTime, maxTime, uncheckedAverage, median);
+            FileIO<T>::appendSummaryEntry(summaryName, timestamp, dataLength, getSortingOrderName("--rand"),
+                (std::string(getAlgorithmName(algFlag)) + " [Unchecked]").c_str(), getDataTypeName<T>(), repeatCount,
+                minTime, maxTime, uncheckedAverage, median, minVal, maxVal);
+
+            std::cout << getAlgorithmName(algFlag) << ": average checked = " << checkedAverage
+                      << " ms, average unchecked = " << uncheckedAverage << " ms." << std::endl;
+        }
+        std::cout << "Summary written to " << summaryName << std::endl;
+    }
+
+    /**
+    * Computes the 1st, 50th, 90th, 99th and 99.9th percentiles of random data in four ways: a full sort,
+    * successive nthElement calls, partialSort of the smallest 1% and topK of the largest 1%.
+    * Every result is checked against the full sort and the timings go to the percentile summary file.
+    */
+    template <typename T>
+    static void percentileBenchmark(int dataLength, int repeatCount, T minVal, T maxVal) {
+        using Algorithms = SortAlgorithms<T>;
+        constexpr int PERCENTILE_COUNT = 5;
+        const double percentiles[PERCENTILE_COUNT] = {1.0, 50.0, 90.0, 99.0, 99.9};
+        const char* methods[] = {"Full Sort (Pattern-Defeating Quick Sort)", "nthElement",
+                                 "Partial Sort (smallest 1%)", "Top-K (largest 1%)"};
+        const std::string timestamp = currentTimestamp();
+        const std::string summaryName = "benchmark_summary_history_percentiles.txt";
+
+        // Nearest-rank index of each percentile.
+        int ranks[PERCENTILE_COUNT];
+        for (int p = 0; p < PERCENTILE_COUNT; ++p)
+            ranks[p] = std::clamp(static_cast<int>(std::ceil(percentiles[p] / 100.0 * dataLength)) - 1, 0,
+                                  std::max(dataLength - 1, 0));
+
+        Vektor<int> times[4];
+        for (int i = 0; i < repeatCount && dataLength > 0; ++i) {
+            const Vektor<T> source = RandomNumbersToSortGenerator::generateDataToSort<T>(dataLength, minVal, maxVal);
+            T expected[PERCENTILE_COUNT];
+            T found[PERCENTILE_COUNT];
+
+            Vektor<T> data = source;
+            times[0].push_back(TimerManager::measureTimeMs([&]() {
+                Algorithms::patternDefeatingSort(data);
+            }));
+            for (int p = 0; p < PERCENTILE_COUNT; ++p)
+                expected[p] = data[ranks[p]];
+
+            data = source;
+            times[1].push_back(TimerManager::measureTimeMs([&]() {
+                // Each call only searches the part behind the previous rank.
+                T* from = data.begin();
+                for (int p = 0; p < PERCENTILE_COUNT; ++p) {
+                    Selection<T>::nthElement(from, data.begin() + ranks[p], data.end());
+                    found[p] = data[ranks[p]];
+                    from = data.begin() + ranks[p] + 1;
+                }
+            }));
+            reportPercentileRun(methods[1], i, times[1][i], std::equal(found, found + PERCENTILE_COUNT, expected));
+
+            data = source;
+            times[2].push_back(TimerManager::measureTimeMs([&]() {
+                Algorithms::partialSort(data, ranks[0] + 1);
+            }));
+            reportPercentileRun(methods[2], i, times[2][i], !(data[ranks[0]] < expected[0])
+                                                             && !(expected[0] < data[ranks[0]]));
+
+            Vektor<T> top;
+            times[3].push_back(TimerManager::measureTimeMs([&]() {
+                top = Algorithms::topK(source, dataLength - ranks[3]);
+            }));
+            const T topP99 = top[dataLength - 1 - ranks[3]];
+            const T topP999 = top[dataLength - 1 - ranks[4]];
+            reportPercentileRun(methods[3], i, times[3][i], !(topP99 < expected[3]) && !(expected[3] < topP99)
+                                                             && !(topP999 < expected[4]) && !(expected[4] < topP999));
+
+            reportPercentileRun(methods[0], i, times[0][i], true);
+            if (i == 0) {
+                std::cout << "Percentiles:";
+                for (int p = 0; p < PERCENTILE_COUNT; ++p)
+                    std::cout << " p" << percentiles[p] << " = " << expected[p] << (p + 1 < PERCENTILE_COUNT ? "," : "");
+                std::cout << std::endl;
+            }
+        }
+
+        for (int m = 0; m < 4 && dataLength > 0; ++m) {
+            int minTime, maxTime;
+            double average, median;
+            summarizeTimes(times[m], minTime, maxTime, average, median);
+            FileIO<T>::appendSummaryEntry(summaryName, timestamp, dataLength, getSortingOrderName("--rand"),
+                methods[m], getDataTypeName<T>(), repeatCount, minTime, maxTime, average, median, minVal, maxVal);
+            std::cout << methods[m] << ": average = " << average << " ms." << std::endl;
+        }
+        std::cout << "Summary written to " << summaryName << std::endl;
+    }
+
+    /**
+    * Sorts the same random inputs with a parallel algorithm using 1, 2, 4, ... threads up to the configured
+    * thread count. Writes one summary row per thread count with the speedup over one thread and the efficiency
+    * to a separate _scaling file, so the serial summary file of the algorithm keeps a single row layout.
+    */
+    template <typename T>
+    static void parallelScalingBenchmark(const char* algFlag, int dataLength, int repeatCount, T minVal, T maxVal) {
+        const std::string timestamp = currentTimestamp();
+        const std::string summaryName = std::string("benchmark_summary_history_") + getAlgorithmName(algFlag) + "_scaling.txt";
+
+        Vektor<Vektor<T>> inputs;
+        inputs.reserve(repeatCount);
+        for (int i = 0; i < repeatCount; ++i)
+            inputs.push_back(RandomNumbersToSortGenerator::generateDataToSort<T>(dataLength, minVal, maxVal));
+
+        const int maxThreads = threadCount;
+        double singleThreadAverage = 0.0;
+        for (int threads = 1; ; threads = std::min(threads * 2, maxThreads)) {
+            setThreadCount(threads);
+            warmPool(algFlag);
+            Vektor<int> times;
+            for (int i = 0; i < repeatCount; ++i) {
+                Vektor<T> data = inputs[i];
+                times.push_back(TimerManager::measureTimeMs([&]() {
+                    sortUsingAlgorithm<T>(data, algFlag);
+                }));
+                const bool isSorted = AlgorithmsUtils<T>::isSorted(data);
+                std::cout << getAlgorithmName(algFlag) << ", Threads = " << threads
+                          << ": Sorted = " << (isSorted ? "Yes" : "No")
+                          << ", Time = " << times[i] << " milliseconds." << std::endl;
+            }
+
+            int minTime, maxTime;
+            double average, median;
+            summarizeTimes(times, minTime, maxTime, average, median);
+            if (threads == 1)
+                singleThreadAverage = average;
+            const double speedup = average > 0.0 ? singleThreadAverage / average : 1.0;
+            const double efficiency = speedup / threads;
+
+            FileIO<T>::appendSummaryEntry(summaryName, timestamp, dataLength, getSortingOrderName("--rand"),
+                getAlgorithmName(algFlag), getDataTypeName<T>(), repeatCount, minTime, maxTime, average, median,
+                minVal, maxVal, threads, speedup, efficiency);
+            std::cout << "Threads = " << threads << ": average = " << average << " ms, speedup = " << speedup
+                      << ", efficiency = " << efficiency << std::endl;
+            if (threads == maxThreads)
+                break;
+        }
+        setThreadCount(maxThreads);
+        std::cout << "Summary written to " << summaryName << std::endl;
+    }
+
 private:
+    static inline int threadCount = std::thread::hardware_concurrency() > 0
+                                        ? static_cast<int>(std::thread::hardware_concurrency()) : 1;
+    static inline std::unique_ptr<WorkStealingPool> pool;
+
+    /// Pool shared by the parallel algorithms; recreated when the thread count changes.
+    static WorkStealingPool& parallelPool() {
+        if (!pool || pool->getThreadCount() != threadCount) {
+            pool.reset();
+            pool = std::make_unique<WorkStealingPool>(threadCount);
+        }
+        return *pool;
+    }
+
+    /// Builds the pool for a parallel algorithm before timing starts, so no measured run pays for spawning threads.
+    static void warmPool(const char* algFlag) {
+        if (std::strcmp(algFlag, "--pqs") == 0 || std::strcmp(algFlag, "--pms") == 0 || std::strcmp(algFlag, "--ss") == 0)
+            parallelPool();
+    }
+
+    /**
+    * Calls action for every flag of a comma-separated list such as "--qs,--q3", so study modes can
+    * run several algorithms on each size or distribution and report them side by side.
+    */
+    template <typename Action>
+    static void forEachAlgorithmFlag(const char* algFlags, Action&& action) {
+        const std::string flags(algFlags);
+        std::size_t start = 0;
+        while (start <= flags.size()) {
+            std::size_t comma = flags.find(',', start);
+            if (comma == std::string::npos) comma = flags.size();
+            if (comma > start) {
+                const std::string flag = flags.substr(start, comma - start);
+                action(flag.c_str());
+            }
+            start = comma + 1;
+        }
+    }
+
+    /// True for the insertion sorts, which are too slow for the large study sizes.
+    static bool isQuadratic(const char* algFlag) {
+        return std::strcmp(algFlag, "--is") == 0 || std::strcmp(algFlag, "--bi") == 0
+            || std::strcmp(algFlag, "--gbi") == 0;
+    }
+
+    /**
+    * Prints the hardware counters of the last measured sort: branch misses next to the branch count,
+    * instructions and cycles. Only the sorting thread is counted, so parallel algorithms show partial numbers.
+    */
+    static void printCounters(const PerfCounters& counters) {
+        if (!counters.isAvailable()) {
+            static bool reported = false;
+            if (!reported)
+                std::cout << "[INFO] Hardware counters unavailable (perf_event_open failed), reporting time only." << std::endl;
+            reported = true;
+            return;
+        }
+        const double missRate = counters.branches() > 0
+                              ? 100.0 * double(counters.branchMisses()) / double(counters.branches()) : 0.0;
+        const double ipc = counters.cycles() > 0 ? double(counters.instructions()) / double(counters.cycles()) : 0.0;
+        std::cout << "Branch misses = " << counters.branchMisses() << " of " << counters.branches()
+                  << " branches (" << std::fixed << std::setprecision(2) << missRate << "%)"
+                  << ", Instructions = " << counters.instructions() << ", Cycles = " << counters.cycles()
+                  << ", IPC = " << ipc << std::defaultfloat << std::endl;
+    }
+
+    static void reportPercentileRun(const char* method, int run, int time, bool matches) {
+        std::cout << method << " run " << run + 1 << ": Matches full sort = " << (matches ? "Yes" : "No")
+                  << ", Time = " << time << " milliseconds." << std::endl;
+    }
+
+    /// Computes min, max, average and median of the collected timings.
+    static void summarizeTimes(const Vektor<int>& times, int& minTime, int& maxTime, double& average, double& median) {
+        const int n = times.size();
+        minTime = n > 0 ? times[0] : 0;
+        maxTime = minTime;
+        long long sum = 0;
+        for (int i = 0; i < n; ++i) {
+            int v = times[i];
+            sum += v;
+            if (v < minTime) minTime = v;
+            if (v > maxTime) maxTime = v;
+        }
+        average = n > 0 ? double(sum) / n : 0.0;
+
+        Vektor<int> scratch = times;
+        median = SortAlgorithms<int>::median(scratch);
+    }
+
+    /// Helper: timestamp "YYYY.MM.DD_HH-MM-SS" used in history and summary files.
+    static std::string currentTimestamp() {
+        auto now = std::chrono::system_clock::now();
+        auto in_time = std::chrono::system_clock::to_time_t(now);
+        std::ostringstream ts;
+        ts << std::put_time(std::localtime(&in_time), "%Y.%m.%d_%H-%M-%S");
+        return ts.str();
+    }
+
     /// Selects and generates data based on the given mode flag (random, sorted, etc.).
     template<typename T>
     static Vektor<T> selectDataByMode(const char* dataModeFlag, int dataLemgth, T minimum, T maximum) {
@@ -224,6 +544,8 @@ private:
             return RandomNumbersToSortGenerator::generate33PercentSortedData<T>(dataLemgth,  minimum, maximum);
         if (std::strcmp(dataModeFlag, "--66") == 0)
             return RandomNumbersToSortGenerator::generate66PercentSortedData<T>(dataLemgth,  minimum, maximum);
+        if (std::strcmp(dataModeFlag, "--few") == 0)
+            return RandomNumbersToSortGenerator::generateFewUniqueData<T>(dataLemgth,  minimum, maximum);
         return RandomNumbersToSortGenerator::generateDataToSort<T>(dataLemgth,  minimum, maximum);
     }
 
@@ -239,6 +561,8 @@ private:
             return "33% Sorted";
         if (std::strcmp(orderFlag, "--66") == 0)
             return "66% Sorted";
+        if (std::strcmp(orderFlag, "--few") == 0)
+            return "Few Unique Values";
 
         return "Unknown Sort Order";
     }
@@ -249,10 +573,34 @@ private:
             return "Insertion Sort";
         if (std::strcmp(algFlag, "--bi") == 0)
             return "Binary Insertion Sort";
+        if (std::strcmp(algFlag, "--gbi") == 0)
+            return "Galloping Binary Insertion Sort";
         if (std::strcmp(algFlag, "--hs") == 0)
             return "Heap Sort";
+        if (std::strcmp(algFlag, "--bhs") == 0)
+            return "Bottom-Up Heap Sort";
+        if (std::strcmp(algFlag, "--hs4") == 0)
+            return "4-Ary Heap Sort";
         if (std::strcmp(algFlag, "--qs") == 0)
             return "Quick Sort";
+        if (std::strcmp(algFlag, "--ps") == 0)
+            return "Pattern-Defeating Quick Sort";
+        if (std::strcmp(algFlag, "--q3") == 0)
+            return "3-Way Quick Sort";
+        if (std::strcmp(algFlag, "--rs") == 0)
+            return "Radix Sort";
+        if (std::strcmp(algFlag, "--pqs") == 0)
+            return "Parallel Quick Sort";
+        if (std::strcmp(algFlag, "--pms") == 0)
+            return "Parallel Merge Sort";
+        if (std::strcmp(algFlag, "--ss") == 0)
+            return "Parallel Sample Sort";
+        if (std::strcmp(algFlag, "--simd") == 0)
+            return "SIMD Quick Sort";
+        if (std::strcmp(algFlag, "--bqs") == 0)
+            return "Block Quick Sort";
+        if (std::strcmp(algFlag, "--ts") == 0)
+            return "Tim Sort";
         return "Unknown Algorithm";
     }
 
@@ -270,16 +618,41 @@ private:
     }
 
     /// Dispatches to the appropriate sorting algorithm implementation based on the flag.
-    template <typename T>
-    static void sortUsingAlgorithm(Vektor<T>& data, const char* algFlag) {
+    template <typename T, typename AccessPolicy = DefaultAccessPolicy>
+    static void sortUsingAlgorithm(Vektor<T, DoublingGrowth, AccessPolicy>& data, const char* algFlag) {
+        using Algorithms = SortAlgorithms<T, AccessPolicy>;
         if (std::strcmp(algFlag, "--is") == 0)
-            SortAlgorithms<T>::insertionSort(data);
+            Algorithms::insertionSort(data);
         else if (std::strcmp(algFlag, "--bi") == 0)
-            SortAlgorithms<T>::binaryInsertionSort(data);
+            Algorithms::binaryInsertionSort(data);
+        else if (std::strcmp(algFlag, "--gbi") == 0)
+            Algorithms::gallopingInsertionSort(data);
         else if (std::strcmp(algFlag, "--hs") == 0)
-            SortAlgorithms<T>::heapSort(data);
+            Algorithms::heapSort(data);
+        else if (std::strcmp(algFlag, "--bhs") == 0)
+            Algorithms::bottomUpHeapSort(data);
+        else if (std::strcmp(algFlag, "--hs4") == 0)
+            Algorithms::quaternaryHeapSort(data);
         else if (std::strcmp(algFlag, "--qs") == 0)
-            SortAlgorithms<T>::quickSort(data);
+            Algorithms::quickSort(data);
+        else if (std::strcmp(algFlag, "--ps") == 0)
+            Algorithms::patternDefeatingSort(data);
+        else if (std::strcmp(algFlag, "--q3") == 0)
+            Algorithms::threeWayQuickSort(data);
+        else if (std::strcmp(algFlag, "--rs") == 0)
+            Algorithms::radixSort(data);
+        else if (std::strcmp(algFlag, "--pqs") == 0)
+            ParallelSortAlgorithms<T, AccessPolicy>::quickSort(data, parallelPool());
+        else if (std::strcmp(algFlag, "--pms") == 0)
+            ParallelSortAlgorithms<T, AccessPolicy>::mergeSort(data, parallelPool());
+        else if (std::strcmp(algFlag, "--ss") == 0)
+            ParallelSortAlgorithms<T, AccessPolicy>::sampleSort(data, parallelPool());
+        else if (std::strcmp(algFlag, "--simd") == 0)
+            Algorithms::simdQuickSort(data);
+        else if (std::strcmp(algFlag, "--bqs") == 0)
+            Algorithms::blockQuickSort(data);
+        else if (std::strcmp(algFlag, "--ts") == 0)
+            Algorithms::timSort(data);
         else {
             std::cerr << "Error: Invalid algorithm flag: " << algFlag << std::endl;
             std::exit(EXIT_FAILURE);
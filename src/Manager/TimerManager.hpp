@@ -2,6 +2,7 @@
 #define TIMERMANAGER_HPP
 
 #include "../Timer/Timer.hpp"
+#include "../Timer/PerfCounters.hpp"
 
 class TimerManager {
 public:
@@ -16,6 +17,18 @@ public:
         timer.stop();
         return timer.result();
     }
+
+    // Same as above, additionally collecting hardware counters of the calling thread around the operation.
+    template<typename Func>
+    static int measureTimeMs(Func executable_function, PerfCounters& counters) {
+        Timer timer;
+        counters.start();
+        timer.start();
+        executable_function();
+        timer.stop();
+        counters.stop();
+        return timer.result();
+    }
 };
 
 #endif
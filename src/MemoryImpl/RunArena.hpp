@@ -0,0 +1,142 @@
+#ifndef RUN_ARENA_HPP
+#define RUN_ARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+/**
+ * Memory resource that forwards to an upstream resource and counts the traffic passing through it.
+ */
+class CountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream;
+    long long allocationCount = 0;
+    std::size_t allocatedBytes = 0;
+
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstreamResource = std::pmr::new_delete_resource())
+        : upstream(upstreamResource) {}
+
+    long long getAllocationCount() const { return allocationCount; }
+    std::size_t getAllocatedBytes() const { return allocatedBytes; }
+
+    void resetCounters() {
+        allocationCount = 0;
+        allocatedBytes = 0;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocationCount;
+        allocatedBytes += bytes;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+/**
+ * Per-run monotonic arena for benchmark repetitions.
+ *
+ * While active, the arena is the default memory resource, so every Vektor created inside the run
+ * (graph storage, algorithm temporaries) bump-allocates from one preallocated buffer and frees nothing.
+ * reset() drops everything at once; if the run overflowed into the heap, the buffer is regrown to the
+ * observed high-water mark so identical following runs cause no heap traffic at all.
+ * Not thread-safe: activate it only around single-threaded work.
+ */
+class RunArena {
+    CountingResource heap;
+    std::pmr::memory_resource* bufferUpstream;
+    std::byte* buffer = nullptr;
+    std::size_t bufferSize = 0;
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+    std::pmr::memory_resource* previousDefault = nullptr;
+    long long lastRunHeapAllocations = 0;
+
+public:
+    explicit RunArena(std::size_t initialBytes = 1 << 20)
+        : bufferUpstream(std::pmr::new_delete_resource()) {
+        allocateBuffer(initialBytes);
+        rebuildArena();
+    }
+
+    RunArena(const RunArena&) = delete;
+    RunArena& operator=(const RunArena&) = delete;
+
+    ~RunArena() {
+        deactivate();
+        arena.reset();
+        bufferUpstream->deallocate(buffer, bufferSize, alignof(std::max_align_t));
+    }
+
+    /// Makes the arena the default memory resource until deactivate() is called.
+    void activate() {
+        if (!previousDefault)
+            previousDefault = std::pmr::set_default_resource(&*arena);
+    }
+
+    /// Restores the default memory resource that was active before activate().
+    void deactivate() {
+        if (previousDefault) {
+            std::pmr::set_default_resource(previousDefault);
+            previousDefault = nullptr;
+        }
+    }
+
+    /**
+     * Releases everything allocated during the run. All objects living in the arena must be gone.
+     * Returns the number of heap allocations the run needed beyond the preallocated buffer.
+     */
+    long long reset() {
+        const bool wasActive = previousDefault != nullptr;
+        deactivate();
+        lastRunHeapAllocations = heap.getAllocationCount();
+        const std::size_t overflowBytes = heap.getAllocatedBytes();
+        arena.reset();
+        if (overflowBytes > 0) {
+            bufferUpstream->deallocate(buffer, bufferSize, alignof(std::max_align_t));
+            allocateBuffer(bufferSize + overflowBytes + overflowBytes / 4);
+        }
+        heap.resetCounters();
+        rebuildArena();
+        if (wasActive)
+            activate();
+        return lastRunHeapAllocations;
+    }
+
+    std::pmr::memory_resource* getResource() { return &*arena; }
+    std::size_t getBufferSize() const { return bufferSize; }
+    long long getLastRunHeapAllocations() const { return lastRunHeapAllocations; }
+
+private:
+    void allocateBuffer(std::size_t bytes) {
+        bufferSize = bytes;
+        buffer = static_cast<std::byte*>(bufferUpstream->allocate(bufferSize, alignof(std::max_align_t)));
+    }
+
+    void rebuildArena() {
+        arena.emplace(buffer, bufferSize, &heap);
+    }
+};
+
+/**
+ * RAII helper: activates a RunArena for the lifetime of the scope.
+ */
+class ScopedRunArena {
+    RunArena& runArena;
+
+public:
+    explicit ScopedRunArena(RunArena& arenaToActivate) : runArena(arenaToActivate) { runArena.activate(); }
+    ~ScopedRunArena() { runArena.deactivate(); }
+
+    ScopedRunArena(const ScopedRunArena&) = delete;
+    ScopedRunArena& operator=(const ScopedRunArena&) = delete;
+};
+
+#endif
@@ -5,11 +5,12 @@
 #include <utility>
 #include <algorithm>
 #include <ctime>
+#include <cmath>
+#include <iostream>
 
 #include "../common/EdgeTriple.hpp"
+#include "../common/EdgeHashSet.hpp"
 #include "../VektorImpl/Vektor.hpp"
-#include "../common/GraphFactory.hpp"
-#include "../common/GraphRepresentingShape.hpp"
 
 class RandomGraphGenerator {
     std::mt19937 rng;
@@ -48,29 +49,6 @@ public:
         return generateGraphWithDensity(v, 99.0);
     }
 
-    /**
-     * Generates a graph (with specific density) and inserts it into an IGraph structure.
-     * Time complexity: O(E), where E is target number of edges.
-     */
-    IGraph* generateGraphInStructure(int v, double density, GraphRepresentingShape type) {
-        std::cout << "[LOG] Generating graph with " << density << "% density and " << v << " vertices into structure.\n";
-        Vektor<EdgeTriple> edges = generateGraphWithDensity(v, density);
-        int maxEdges = v * (v - 1) / 2;
-
-        IGraph* graph = createGraphInstance(type, v, maxEdges);
-        if (!graph) {
-            std::cerr << "[ERROR] Graph creation failed.\n";
-            return nullptr;
-        }
-
-        std::cout << "[LOG] Created graph instance. Inserting " << edges.size() << " edges...\n";
-        for (int i = 0; i < edges.size(); ++i) {
-            graph->addEdge(edges[i].from, edges[i].to, edges[i].weight);
-        }
-        std::cout << "[LOG] Graph generation into structure complete.\n";
-        return graph;
-    }
-
     /**
     * Logs the actual density of a generated graph and compares it to the intended density.
     */
@@ -85,7 +63,38 @@ public:
         }
     }
 
+    /**
+     * Generates a graph with desired density by:
+     * - creating a random spanning tree (to guarantee connectivity)
+     * - adding additional random edges until target density is met
+     * Time complexity: O(V^2) for generating and shuffling all candidate edges, O(1) expected per duplicate check
+    */
+    Vektor<EdgeTriple> generateGraphWithDensity(int vertexCount, double densityPercent) {
+        int maxEdges = vertexCount * (vertexCount - 1) / 2;
+        int targetEdgeCount = static_cast<int>(densityPercent * maxEdges / 100.0);
+        std::cout << "[LOG] Generating graph with " << targetEdgeCount << " edges (target density).\n";
 
+        Vektor<EdgeTriple> spanningTree = generateSpanningTree(vertexCount);
+        Vektor<EdgeTriple> graph;
+        EdgeHashSet usedEdges(std::max(targetEdgeCount, spanningTree.size()));
+        graph.reserve(std::max(targetEdgeCount, spanningTree.size()));
+        graph.insertEnd(spanningTree.begin(), spanningTree.end());
+
+        for (int i = 0; i < spanningTree.size(); ++i) {
+            usedEdges.insert(spanningTree[i].from, spanningTree[i].to);
+        }
+
+        Vektor<EdgeTriple> allEdges = generateAllPossibleEdges(vertexCount);
+        std::shuffle(&allEdges[0], &allEdges[0] + allEdges.size(), rng);
+
+        for (int i = 0; i < allEdges.size() && graph.size() < targetEdgeCount; ++i) {
+            if (!usedEdges.insert(allEdges[i].from, allEdges[i].to)) continue;
+            graph.push_back(allEdges[i]);
+        }
+
+        std::cout << "[LOG] Final graph has " << graph.size() << " edges.\n";
+        return graph;
+    }
 
 private:
 
@@ -109,27 +118,6 @@ private:
         return dist(rng);
     }
 
-    /**
-    * Checks if an edge (u,v) or (v,u) already exists in edgeList.
-    */
-    static bool edgeExists(const Vektor<std::pair<int, int>>& edgeList, int u, int v) {
-        int a = std::min(u, v);
-        int b = std::max(u, v);
-        for (int i = 0; i < edgeList.size(); ++i) {
-            if (edgeList[i].first == a && edgeList[i].second == b) {
-                return true;
-            }
-        }
-        return false;
-    }
-
-    /**
-     * Adds edge (u,v) to the seen set, ensuring consistent ordering.
-     */
-    static void addEdgeRecord(Vektor<std::pair<int, int>>& edgeList, int u, int v) {
-        edgeList.push_back({std::min(u, v), std::max(u, v)});
-    }
-
     /**
      * Generates a random spanning tree using randomized Prim-like logic.
      * Ensures connectivity. Time complexity: O(V)
@@ -139,6 +127,9 @@ private:
         Vektor<EdgeTriple> edges;
         Vektor<int> connected;
         Vektor<int> unconnected;
+        edges.reserve(vertexCount - 1);
+        connected.reserve(vertexCount);
+        unconnected.reserve(vertexCount);
 
         for (int i = 0; i < vertexCount; ++i) unconnected.push_back(i);
 
@@ -176,6 +167,7 @@ private:
      */
     Vektor<EdgeTriple> generateAllPossibleEdges(int vertexCount) {
         Vektor<EdgeTriple> allEdges;
+        allEdges.reserve(vertexCount * (vertexCount - 1) / 2);
         for (int u = 0; u < vertexCount; ++u) {
             for (int v = u + 1; v < vertexCount; ++v) {
                 allEdges.push_back({u, v, getRandomWeight()});
@@ -183,41 +175,6 @@ private:
         }
         return allEdges;
     }
-
-    /**
-     * Generates a graph with desired density by:
-     * - creating a random spanning tree (to guarantee connectivity)
-     * - adding additional random edges until target density is met
-     * Time complexity: O(V + E + V^2) worst-case due to shuffle/search
-    */
-    Vektor<EdgeTriple> generateGraphWithDensity(int vertexCount, double densityPercent) {
-        int maxEdges = vertexCount * (vertexCount - 1) / 2;
-        int targetEdgeCount = static_cast<int>(densityPercent * maxEdges / 100.0);
-        std::cout << "[LOG] Generating graph with " << targetEdgeCount << " edges (target density).\n";
-
-        Vektor<EdgeTriple> spanningTree = generateSpanningTree(vertexCount);
-        Vektor<EdgeTriple> graph = spanningTree;
-        Vektor<std::pair<int, int>> usedEdges;
-
-        for (int i = 0; i < spanningTree.size(); ++i) {
-            addEdgeRecord(usedEdges, spanningTree[i].from, spanningTree[i].to);
-        }
-
-        Vektor<EdgeTriple> allEdges = generateAllPossibleEdges(vertexCount);
-        std::shuffle(&allEdges[0], &allEdges[0] + allEdges.size(), rng);
-
-        for (int i = 0; i < allEdges.size() && graph.size() < targetEdgeCount; ++i) {
-            int a = allEdges[i].from;
-            int b = allEdges[i].to;
-            if (edgeExists(usedEdges, a, b)) continue;
-
-            graph.push_back(allEdges[i]);
-            addEdgeRecord(usedEdges, a, b);
-        }
-
-        std::cout << "[LOG] Final graph has " << graph.size() << " edges.\n";
-        return graph;
-    }
 };
 
 #endif
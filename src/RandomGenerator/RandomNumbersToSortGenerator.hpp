@@ -80,6 +80,24 @@ public:
         return result;
     }
 
+    /**
+     * Generates data drawn from only uniqueCount distinct values of the given range, in random order.
+     * Duplicate-heavy input for comparing two-way and three-way partitioning.
+     */
+    template <typename T>
+    static Vektor<T> generateFewUniqueData(int dataLength, T minValue = T(0), T maxValue = T(1000), int uniqueCount = 10) {
+        Vektor<T> values = generateDataToSort<T>(uniqueCount, minValue, maxValue);
+        Vektor<T> result;
+        result.reserve(dataLength);
+        std::random_device rd;
+        std::mt19937 generator(rd());
+        std::uniform_int_distribution<int> pick(0, uniqueCount - 1);
+        for (int idx = 0; idx < dataLength; ++idx) {
+            result.push_back(values[pick(generator)]);
+        }
+        return result;
+    }
+
     /// Convenience: generates data with 33% of elements sorted.
     template <typename T>
     static Vektor<T> generate33PercentSortedData(int dataLength, T minValue = T(0), T maxValue = T(1000)) {
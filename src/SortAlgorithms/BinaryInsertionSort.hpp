@@ -0,0 +1,93 @@
+#ifndef BINARY_INSERTION_SORT_HPP
+#define BINARY_INSERTION_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Stable binary insertion sort on a raw [first, last) range, used on its own and as the small-range
+ * finisher of the quicksort engines and TimSort's run extension.
+ *
+ * - An element that is not smaller than its predecessor stays in place after a single comparison.
+ * - Otherwise the insert position is found by galloping from the tail of the sorted prefix (offsets 1, 2, 4, ...)
+ *   and a binary search inside the last bracket, so an element that belongs d places back costs
+ *   O(log d) comparisons instead of O(log n), which suits nearly sorted input.
+ * - The sorted elements behind the position are shifted as one block: memmove for trivially copyable T
+ *   (vectorized by the C library), std::move_backward otherwise.
+ * Requires T to provide operator<.
+ */
+template <typename T>
+class BinaryInsertionSort {
+public:
+    /**
+     * Sorts [first, last) in ascending order, stable.
+     * Time complexity: O(n log n) comparisons, O(n^2) element moves done as block moves.
+     */
+    static void sort(T* first, T* last) {
+        if (last - first > 1)
+            extend(first, first + 1, last);
+    }
+
+    /**
+     * Extends the sorted prefix [first, sortedEnd) to the whole [first, last).
+     * Time complexity: O((last - sortedEnd) * log n) comparisons.
+     */
+    static void extend(T* first, T* sortedEnd, T* last) {
+        if (sortedEnd == first && sortedEnd != last) ++sortedEnd;
+        for (; sortedEnd < last; ++sortedEnd) {
+            if (!(*sortedEnd < *(sortedEnd - 1))) continue;
+
+            T value = std::move(*sortedEnd);
+            T* position = gallopFromTail(first, sortedEnd, value);
+            shiftRight(position, sortedEnd);
+            *position = std::move(value);
+        }
+    }
+
+private:
+    /**
+     * Returns the upper bound of value in the sorted [first, end), given value < *(end - 1).
+     * Time complexity: O(log d), where d is the distance of the result from end.
+     */
+    static T* gallopFromTail(T* first, T* end, const T& value) {
+        const std::ptrdiff_t size = end - first;
+        std::ptrdiff_t lastOffset = 1;
+        std::ptrdiff_t offset = 2;
+        while (offset <= size && value < *(end - offset)) {
+            lastOffset = offset;
+            offset *= 2;
+        }
+        // value < *(end - lastOffset) and, if offset is in range, *(end - offset) <= value.
+        T* low = offset > size ? first : end - offset + 1;
+        return upperBound(low, end - lastOffset, value);
+    }
+
+    /**
+     * Upper bound in [low, high), given value < *high. The halving step is a conditional move, not a branch,
+     * because on random input every step would otherwise be a coin-flip misprediction.
+     * Time complexity: O(log(high - low))
+     */
+    static T* upperBound(T* low, T* high, const T& value) {
+        std::ptrdiff_t length = high - low;
+        if (length == 0) return low;
+        while (length > 1) {
+            const std::ptrdiff_t half = length / 2;
+            low = value < low[half] ? low : low + half;
+            length -= half;
+        }
+        return low + !(value < *low);
+    }
+
+    /// Moves [position, end) one slot to the right.
+    static void shiftRight(T* position, T* end) {
+        if constexpr (std::is_trivially_copyable_v<T>)
+            std::memmove(position + 1, position, static_cast<std::size_t>(end - position) * sizeof(T));
+        else
+            std::move_backward(position, end, end + 1);
+    }
+};
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef BLOCK_QUICK_SORT_HPP
+#define BLOCK_QUICK_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "BinaryInsertionSort.hpp"
+#include "PatternDefeatingSort.hpp"
+
+/**
+ * Quicksort with BlockQuicksort partitioning (Edelkamp and Weiss) on a raw [first, last) range.
+ *
+ * Instead of branching on every comparison with the pivot, the partition scans a block of BLOCK_SIZE
+ * elements from each end and records the offsets of misplaced elements: the offset is always written
+ * and the counter is advanced by the comparison result. The recorded elements are then swapped in one
+ * batch, so the only data-dependent work is arithmetic and random input causes almost no branch mispredictions.
+ *
+ * Median-of-three pivot, binary insertion sort below INSERTION_SORT_THRESHOLD, and a fallback to pattern-defeating
+ * quicksort after 2 log n levels, which bounds the worst case at O(n log n). Requires T to provide operator<.
+ */
+template <typename T>
+class BlockQuickSort {
+public:
+    /**
+     * Sorts [first, last) in ascending order, not stable.
+     * Time complexity: O(n log n) average and worst case.
+     */
+    static void sort(T* first, T* last) {
+        const std::ptrdiff_t size = last - first;
+        if (size < 2) return;
+        sortLoop(first, last, 2 * floorLog2(size));
+    }
+
+private:
+    static constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+    static constexpr std::ptrdiff_t BLOCK_SIZE = 64;
+
+    static int floorLog2(std::ptrdiff_t n) {
+        int log = 0;
+        while (n >>= 1) ++log;
+        return log;
+    }
+
+    static void sortLoop(T* begin, T* end, int depthLimit) {
+        while (end - begin >= INSERTION_SORT_THRESHOLD) {
+            if (depthLimit-- == 0) {
+                PatternDefeatingSort<T>::sort(begin, end);
+                return;
+            }
+
+            // Median of three goes to *begin, the largest of the three to end - 1 (a sentinel for the scans).
+            sort3(begin + (end - begin) / 2, begin, end - 1);
+            T* pivotPos = blockPartition(begin, end);
+
+            if (pivotPos - begin < end - (pivotPos + 1)) {
+                sortLoop(begin, pivotPos, depthLimit);
+                begin = pivotPos + 1;
+            } else {
+                sortLoop(pivotPos + 1, end, depthLimit);
+                end = pivotPos;
+            }
+        }
+        BinaryInsertionSort<T>::sort(begin, end);
+    }
+
+    /**
+     * Partitions around *begin into [< pivot] pivot [>= pivot] and returns the pivot position.
+     * Time complexity: O(n), with no branches that depend on the comparison results inside a block.
+     */
+    static T* blockPartition(T* begin, T* end) {
+        T pivot = std::move(*begin);
+        T* first = begin;
+        T* last = end;
+
+        // Skip the prefix and suffix that are already on the correct side.
+        while (*++first < pivot);
+        if (first - 1 == begin) {
+            while (first < last && !(*--last < pivot));
+        } else {
+            while (!(*--last < pivot));
+        }
+
+        if (first < last) {
+            std::iter_swap(first, last);
+            ++first;
+
+            unsigned char offsetsLeft[BLOCK_SIZE];
+            unsigned char offsetsRight[BLOCK_SIZE];
+            T* leftBase = first;
+            T* rightBase = last;
+            std::ptrdiff_t countLeft = 0, countRight = 0, startLeft = 0, startRight = 0;
+
+            while (first < last) {
+                // Refill whichever offset buffer is empty; split the unknown range if both are.
+                const std::ptrdiff_t unknown = last - first;
+                const std::ptrdiff_t leftSplit = countLeft == 0 ? (countRight == 0 ? unknown / 2 : unknown) : 0;
+                const std::ptrdiff_t rightSplit = countRight == 0 ? unknown - leftSplit : 0;
+
+                const std::ptrdiff_t leftScan = std::min(leftSplit, BLOCK_SIZE);
+                for (std::ptrdiff_t i = 0; i < leftScan; ++i) {
+                    offsetsLeft[countLeft] = static_cast<unsigned char>(i);
+                    countLeft += !(*first < pivot);
+                    ++first;
+                }
+                const std::ptrdiff_t rightScan = std::min(rightSplit, BLOCK_SIZE);
+                for (std::ptrdiff_t i = 0; i < rightScan; ++i) {
+                    offsetsRight[countRight] = static_cast<unsigned char>(i + 1);
+                    countRight += *--last < pivot;
+                }
+
+                const std::ptrdiff_t swaps = std::min(countLeft, countRight);
+                swapOffsets(leftBase, rightBase, offsetsLeft + startLeft, offsetsRight + startRight,
+                            swaps, countLeft == countRight);
+                countLeft -= swaps;
+                countRight -= swaps;
+                startLeft += swaps;
+                startRight += swaps;
+
+                if (countLeft == 0) {
+                    startLeft = 0;
+                    leftBase = first;
+                }
+                if (countRight == 0) {
+                    startRight = 0;
+                    rightBase = last;
+                }
+            }
+
+            // One buffer may still hold misplaced elements; move them next to the boundary.
+            if (countLeft) {
+                while (countLeft--)
+                    std::iter_swap(leftBase + offsetsLeft[startLeft + countLeft], --last);
+                first = last;
+            }
+            if (countRight) {
+                while (countRight--) {
+                    std::iter_swap(rightBase - offsetsRight[startRight + countRight], first);
+                    ++first;
+                }
+            }
+        }
+
+        T* pivotPos = first - 1;
+        *begin = std::move(*pivotPos);
+        *pivotPos = std::move(pivot);
+        return pivotPos;
+    }
+
+    /**
+     * Exchanges count recorded element pairs. With unequal buffer fill levels a cyclic permutation is used,
+     * which needs one move per element instead of the three of a swap.
+     */
+    static void swapOffsets(T* leftBase, T* rightBase, const unsigned char* offsetsLeft,
+                            const unsigned char* offsetsRight, std::ptrdiff_t count, bool useSwaps) {
+        if (useSwaps) {
+            for (std::ptrdiff_t i = 0; i < count; ++i)
+                std::iter_swap(leftBase + offsetsLeft[i], rightBase - offsetsRight[i]);
+        } else if (count > 0) {
+            T* left = leftBase + offsetsLeft[0];
+            T* right = rightBase - offsetsRight[0];
+            T saved = std::move(*left);
+            *left = std::move(*right);
+            for (std::ptrdiff_t i = 1; i < count; ++i) {
+                left = leftBase + offsetsLeft[i];
+                *right = std::move(*left);
+                right = rightBase - offsetsRight[i];
+                *left = std::move(*right);
+            }
+            *right = std::move(saved);
+        }
+    }
+
+    static void sort2(T* a, T* b) {
+        if (*b < *a) std::iter_swap(a, b);
+    }
+
+    /// Orders *a <= *b <= *c.
+    static void sort3(T* a, T* b, T* c) {
+        sort2(a, b);
+        sort2(b, c);
+        sort2(a, b);
+    }
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef BOTTOM_UP_HEAP_SORT_HPP
+#define BOTTOM_UP_HEAP_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+/**
+ * In-place heapsort with Floyd's bottom-up sift-down on a raw [first, last) range, for a heap of any arity.
+ *
+ * The classic sift-down compares the sifted value with the larger child on every level, although it
+ * almost always ends near a leaf. Bottom-up sift-down first walks the path of larger children down to a leaf,
+ * moving each child up into the hole, and only then bubbles the value up from the leaf, which saves
+ * about one comparison per level. The loop is iterative and moves values instead of swapping them.
+ *
+ * With Arity = 4 the heap is half as deep and the four siblings of a node are adjacent (16 bytes of int,
+ * 32 of double), so each level costs about one cache line instead of two levels' worth of misses.
+ * The first grandchild of the current node is prefetched while its children are compared, hiding part of
+ * the memory latency once the heap no longer fits in cache. Requires T to provide operator<.
+ */
+template <typename T, int Arity = 2>
+class BottomUpHeapSort {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
+public:
+    /**
+     * Sorts [first, last) in ascending order, not stable, O(1) extra memory.
+     * Time complexity: O(n log n) in every case.
+     */
+    static void sort(T* first, T* last) {
+        const std::ptrdiff_t size = last - first;
+        if (size < 2) return;
+
+        for (std::ptrdiff_t node = (size - 2) / Arity; node >= 0; --node) {
+            T value = std::move(first[node]);
+            siftDown(first, node, size, std::move(value));
+        }
+        for (std::ptrdiff_t end = size - 1; end > 0; --end) {
+            T value = std::move(first[end]);
+            first[end] = std::move(first[0]);
+            siftDown(first, 0, end, std::move(value));
+        }
+    }
+
+private:
+    /**
+     * Fills the hole at index hole of a heap of heapSize elements with value.
+     * Time complexity: O(Arity * log_Arity n)
+     */
+    static void siftDown(T* heap, std::ptrdiff_t hole, std::ptrdiff_t heapSize, T value) {
+        const std::ptrdiff_t top = hole;
+
+        // Descend to a leaf along the larger children without looking at value.
+        std::ptrdiff_t child = Arity * hole + 1;
+        while (child < heapSize) {
+            const std::ptrdiff_t grandchild = Arity * child + 1;
+            if (grandchild < heapSize)
+                __builtin_prefetch(heap + grandchild);
+
+            std::ptrdiff_t largest = child;
+            const std::ptrdiff_t lastChild = std::min(child + Arity, heapSize);
+            for (std::ptrdiff_t sibling = child + 1; sibling < lastChild; ++sibling)
+                if (heap[largest] < heap[sibling])
+                    largest = sibling;
+
+            heap[hole] = std::move(heap[largest]);
+            hole = largest;
+            child = Arity * hole + 1;
+        }
+
+        // Bubble value up from the leaf; it usually belongs within a level or two of the bottom.
+        while (hole > top) {
+            const std::ptrdiff_t parent = (hole - 1) / Arity;
+            if (!(heap[parent] < value)) break;
+            heap[hole] = std::move(heap[parent]);
+            hole = parent;
+        }
+        heap[hole] = std::move(value);
+    }
+};
+
+#endif
@@ -0,0 +1,286 @@
+#ifndef PARALLEL_SORT_ALGORITHMS_HPP
+#define PARALLEL_SORT_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "../ThreadPoolImpl/WorkStealingPool.hpp"
+#include "../VektorImpl/Vektor.hpp"
+#include "PatternDefeatingSort.hpp"
+#include "SimdSort.hpp"
+#include "SortAlgorithms.hpp"
+
+/**
+ * Divide-and-conquer sorts whose recursion is split into tasks on a WorkStealingPool.
+ * Subranges below SEQUENTIAL_CUTOFF elements are finished sequentially by SimdSort (AVX2 kernels where available,
+ * pattern-defeating quicksort otherwise), so task overhead stays small compared to the work of a task.
+ */
+template <typename T, typename AccessPolicy = DefaultAccessPolicy>
+class ParallelSortAlgorithms {
+public:
+    using Container = typename SortAlgorithms<T, AccessPolicy>::Container;
+
+    /**
+     * Sorts the vector using quick sort; both sides of every partition are sorted as parallel tasks.
+     * Time complexity: O(n log n) work, O(n) span (the top-level partition is sequential).
+     */
+    static void quickSort(Container& data_to_sort, WorkStealingPool& pool) {
+        const std::ptrdiff_t size = data_to_sort.size();
+        TaskGroup group(pool);
+        quickSortTask(group, data_to_sort.begin(), data_to_sort.end(), 2 * floorLog2(size));
+        group.wait();
+    }
+
+    /**
+     * Sorts the vector using merge sort; halves are sorted and merged as parallel tasks, with one scratch buffer.
+     * Time complexity: O(n log n) work, O(log^3 n) span, additional memory O(n).
+     */
+    static void mergeSort(Container& data_to_sort, WorkStealingPool& pool) {
+        const int size = data_to_sort.size();
+        if (size < 2) return;
+        Vektor<T> buffer(size);
+        TaskGroup group(pool);
+        mergeSortTask(group, data_to_sort.begin(), data_to_sort.end(), buffer.begin());
+        group.wait();
+    }
+
+    /**
+     * Sorts the vector using sample sort: splitters taken from a sorted random sample form an implicit
+     * search tree, blocks of the input are classified into buckets in parallel, scattered into one buffer,
+     * and every bucket is sorted as its own task. Unlike quickSort there is no sequential top-level pass.
+     * When the sample repeats a splitter, as with heavily duplicated keys, every bucket gets an equality bucket
+     * for keys equal to its upper splitter (as in IPS4o); those need no sorting, so one frequent key cannot
+     * leave a single task with most of the input.
+     * Time complexity: O(n log n) work, O(n / threads + log n) span for well-spread keys, additional memory O(n).
+     */
+    static void sampleSort(Container& data_to_sort, WorkStealingPool& pool) {
+        const int size = data_to_sort.size();
+        if (size <= SEQUENTIAL_CUTOFF) {
+            SimdSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+            return;
+        }
+        T* const data = data_to_sort.begin();
+
+        const int treeLevels = std::clamp(floorLog2(size / SEQUENTIAL_CUTOFF), 1, MAX_TREE_LEVELS);
+        const Splitters splitters = buildSplitters(data, size, 1 << treeLevels);
+        const int bucketCount = splitters.repeated ? 2 << treeLevels : 1 << treeLevels;
+
+        const int blockCount = std::clamp(static_cast<int>(size / SEQUENTIAL_CUTOFF), 1, 4 * pool.getThreadCount());
+        const int blockSize = (size + blockCount - 1) / blockCount;
+        Vektor<unsigned short> bucketOf;
+        bucketOf.reserve(size);
+        Vektor<int> blockOffsets(blockCount * bucketCount);
+
+        TaskGroup group(pool);
+        for (int block = 0; block < blockCount; ++block) {
+            group.run([&, block]() {
+                const int begin = block * blockSize;
+                const int end = std::min(begin + blockSize, size);
+                int* counts = blockOffsets.begin() + block * bucketCount;
+                unsigned short* buckets = bucketOf.begin();
+                for (int i = begin; i < end; ++i) {
+                    const int bucket = classify(splitters, treeLevels, data[i]);
+                    buckets[i] = static_cast<unsigned short>(bucket);
+                    ++counts[bucket];
+                }
+            });
+        }
+        group.wait();
+
+        // Bucket-major prefix sum: each block writes its share of a bucket right after the previous block.
+        Vektor<int> bucketStarts(bucketCount + 1);
+        int offset = 0;
+        for (int bucket = 0; bucket < bucketCount; ++bucket) {
+            bucketStarts[bucket] = offset;
+            for (int block = 0; block < blockCount; ++block) {
+                const int count = blockOffsets[block * bucketCount + bucket];
+                blockOffsets[block * bucketCount + bucket] = offset;
+                offset += count;
+            }
+        }
+        bucketStarts[bucketCount] = size;
+
+        // The scatter writes every slot before it is read, so trivially copyable keys skip value-initialization.
+        Vektor<T> buffer;
+        if constexpr (std::is_trivially_copyable_v<T>)
+            buffer.reserve(size);
+        else
+            buffer.append_n(size, T());
+        T* const scratch = buffer.begin();
+        for (int block = 0; block < blockCount; ++block) {
+            group.run([&, block]() {
+                const int begin = block * blockSize;
+                const int end = std::min(begin + blockSize, size);
+                int* cursors = blockOffsets.begin() + block * bucketCount;
+                const unsigned short* buckets = bucketOf.begin();
+                for (int i = begin; i < end; ++i)
+                    scratch[cursors[buckets[i]]++] = data[i];
+            });
+        }
+        group.wait();
+
+        for (int bucket = 0; bucket < bucketCount; ++bucket) {
+            group.run([&, bucket]() {
+                T* first = scratch + bucketStarts[bucket];
+                T* last = scratch + bucketStarts[bucket + 1];
+                if (!splitters.repeated || bucket % 2 == 0)
+                    SimdSort<T>::sort(first, last);
+                std::copy(first, last, data + bucketStarts[bucket]);
+            });
+        }
+        group.wait();
+    }
+
+private:
+    static constexpr std::ptrdiff_t SEQUENTIAL_CUTOFF = 1 << 14;
+    static constexpr int MAX_TREE_LEVELS = 8;
+    static constexpr int OVERSAMPLING = 16;
+
+    /// Splitters of a sample sort pass, as an implicit search tree and in ascending order.
+    struct Splitters {
+        Vektor<T> tree;
+        Vektor<T> sorted;
+        bool repeated = false;
+    };
+
+    /**
+     * Draws OVERSAMPLING * bucketCount random elements, sorts them and takes every OVERSAMPLING-th one as a splitter.
+     * The tree stores them in implicit binary search tree order: the children of node j are 2j and 2j + 1, root at 1.
+     */
+    static Splitters buildSplitters(const T* data, int size, int bucketCount) {
+        const int sampleSize = OVERSAMPLING * bucketCount;
+        Vektor<T> sample;
+        sample.reserve(sampleSize);
+        std::mt19937 generator(static_cast<unsigned>(size));
+        std::uniform_int_distribution<int> index(0, size - 1);
+        for (int i = 0; i < sampleSize; ++i)
+            sample.push_back(data[index(generator)]);
+        PatternDefeatingSort<T>::sort(sample.begin(), sample.end());
+
+        Splitters splitters;
+        splitters.sorted.reserve(bucketCount - 1);
+        for (int i = 1; i < bucketCount; ++i) {
+            const T& splitter = sample[OVERSAMPLING * i];
+            if (i > 1 && !(splitters.sorted[i - 2] < splitter)) splitters.repeated = true;
+            splitters.sorted.push_back(splitter);
+        }
+        splitters.tree.append_n(bucketCount, splitters.sorted[0]);
+        int next = 0;
+        fillTree(splitters, 1, bucketCount, next);
+        return splitters;
+    }
+
+    /// In-order walk of the implicit tree, so node values increase from left to right.
+    static void fillTree(Splitters& splitters, int node, int bucketCount, int& next) {
+        if (node >= bucketCount) return;
+        fillTree(splitters, 2 * node, bucketCount, next);
+        splitters.tree[node] = splitters.sorted[next++];
+        fillTree(splitters, 2 * node + 1, bucketCount, next);
+    }
+
+    /**
+     * Walks the splitter tree without branches on the comparison result; bucket b then holds the keys
+     * above splitter b - 1 and up to splitter b. With repeated splitters it returns 2b for keys below
+     * splitter b and 2b + 1 for keys equal to it.
+     */
+    static int classify(const Splitters& splitters, int treeLevels, const T& value) {
+        int node = 1;
+        for (int level = 0; level < treeLevels; ++level)
+            node = 2 * node + (splitters.tree[node] < value);
+        const int bucket = node - (1 << treeLevels);
+        if (!splitters.repeated) return bucket;
+        const bool equal = bucket < splitters.sorted.size() && !(value < splitters.sorted[bucket]);
+        return 2 * bucket + equal;
+    }
+
+    static int floorLog2(std::ptrdiff_t n) {
+        int log = 0;
+        while (n >>= 1) ++log;
+        return log;
+    }
+
+    /**
+     * Partitions [first, last) into [< pivot] [== pivot] [> pivot], spawns the left part and continues with the right one.
+     * After depthLimit levels the range is sorted sequentially, which keeps the worst case at O(n log n).
+     */
+    static void quickSortTask(TaskGroup& group, T* first, T* last, int depthLimit) {
+        while (last - first > SEQUENTIAL_CUTOFF && depthLimit-- > 0) {
+            const T pivot = medianOfThree(*first, first[(last - first) / 2], *(last - 1));
+            T* lessEnd = std::partition(first, last, [&](const T& value) { return value < pivot; });
+            T* equalEnd = std::partition(lessEnd, last, [&](const T& value) { return !(pivot < value); });
+
+            group.run([&group, first, lessEnd, depthLimit]() {
+                quickSortTask(group, first, lessEnd, depthLimit);
+            });
+            first = equalEnd;
+        }
+        SimdSort<T>::sort(first, last);
+    }
+
+    /**
+     * Sorts [first, last) in place using buffer (same length) as scratch space.
+     */
+    static void mergeSortTask(TaskGroup& group, T* first, T* last, T* buffer) {
+        const std::ptrdiff_t size = last - first;
+        if (size <= SEQUENTIAL_CUTOFF) {
+            SimdSort<T>::sort(first, last);
+            return;
+        }
+
+        T* middle = first + size / 2;
+        {
+            TaskGroup halves(group.getPool());
+            halves.run([&halves, first, middle, buffer]() {
+                mergeSortTask(halves, first, middle, buffer);
+            });
+            mergeSortTask(halves, middle, last, buffer + (middle - first));
+            halves.wait();
+        }
+
+        std::copy(first, last, buffer);
+        TaskGroup merges(group.getPool());
+        mergeTask(merges, buffer, buffer + (middle - first), buffer + (middle - first), buffer + size, first);
+        merges.wait();
+    }
+
+    /**
+     * Merges the sorted runs [a, aEnd) and [b, bEnd) into out. Large merges are split at the middle
+     * element of the longer run and its lower bound in the shorter run, and the two halves merge in parallel.
+     * Stable: on ties elements of the first run come first.
+     */
+    static void mergeTask(TaskGroup& group, const T* a, const T* aEnd, const T* b, const T* bEnd, T* out) {
+        while ((aEnd - a) + (bEnd - b) > SEQUENTIAL_CUTOFF) {
+            const T* aSplit;
+            const T* bSplit;
+            if (aEnd - a >= bEnd - b) {
+                aSplit = a + (aEnd - a) / 2;
+                bSplit = std::lower_bound(b, bEnd, *aSplit);
+            } else {
+                bSplit = b + (bEnd - b) / 2;
+                aSplit = std::upper_bound(a, aEnd, *bSplit);
+            }
+            T* outSplit = out + (aSplit - a) + (bSplit - b);
+
+            group.run([&group, aSplit, aEnd, bSplit, bEnd, outSplit]() {
+                mergeTask(group, aSplit, aEnd, bSplit, bEnd, outSplit);
+            });
+            aEnd = aSplit;
+            bEnd = bSplit;
+        }
+        std::merge(a, aEnd, b, bEnd, out, [](const T& left, const T& right) { return left < right; });
+    }
+
+    static T medianOfThree(const T& a, const T& b, const T& c) {
+        if (a < b) {
+            if (b < c) return b;
+            return a < c ? c : a;
+        }
+        if (a < c) return a;
+        return b < c ? c : b;
+    }
+};
+
+#endif
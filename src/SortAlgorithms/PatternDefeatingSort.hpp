@@ -0,0 +1,288 @@
+#ifndef PATTERN_DEFEATING_SORT_HPP
+#define PATTERN_DEFEATING_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "../VektorImpl/Vektor.hpp"
+#include "BinaryInsertionSort.hpp"
+
+/**
+ * Pattern-defeating quicksort (introsort family) on a raw [first, last) range.
+ *
+ * - median-of-three pivot, Tukey's ninther for ranges above NINTHER_THRESHOLD;
+ * - binary insertion sort (see BinaryInsertionSort) below INSERTION_SORT_THRESHOLD;
+ * - heapsort fallback once too many unbalanced partitions were seen (O(n log n) worst case);
+ * - recursion only into the smaller side, so stack depth is O(log n);
+ * - a partition that needed no swaps is finished with a bounded insertion sort, which makes
+ *   sorted inputs linear, and equal-to-pivot runs are split off in one pass;
+ * - a long ascending or descending prefix is detected up front: descending runs are reversed,
+ *   and only the rest is sorted and merged into the run.
+ *
+ * Requires T to provide operator<.
+ */
+template <typename T>
+class PatternDefeatingSort {
+public:
+    /**
+     * Sorts [first, last) in ascending order, not stable.
+     * Time complexity: O(n log n) worst case, O(n) for already sorted or reversed input.
+     */
+    static void sort(T* first, T* last) {
+        const std::ptrdiff_t size = last - first;
+        if (size < 2) return;
+        if (sortPresortedInput(first, last)) return;
+        sortLoop(first, last, floorLog2(size), true);
+    }
+
+private:
+    static constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+    static constexpr std::ptrdiff_t NINTHER_THRESHOLD = 128;
+    static constexpr std::ptrdiff_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+    static int floorLog2(std::ptrdiff_t n) {
+        int log = 0;
+        while (n >>= 1) ++log;
+        return log;
+    }
+
+    /**
+     * Handles inputs that start with a long run: a fully ascending range is left as is,
+     * a fully non-increasing one is reversed, and a run covering at least a quarter of the range
+     * is kept while the remainder is sorted and merged into it.
+     * Returns true when the range is sorted.
+     * Time complexity: O(n) plus sorting the part after the run.
+     */
+    static bool sortPresortedInput(T* first, T* last) {
+        const std::ptrdiff_t size = last - first;
+
+        T* runEnd = first + 1;
+        if (*runEnd < *first) {
+            while (runEnd != last && !(*(runEnd - 1) < *runEnd)) ++runEnd;
+            if (runEnd - first < size / 4) return false;
+            std::reverse(first, runEnd);
+        } else {
+            while (runEnd != last && !(*runEnd < *(runEnd - 1))) ++runEnd;
+            if (runEnd - first < size / 4) return false;
+        }
+        if (runEnd == last) return true;
+
+        sortLoop(runEnd, last, floorLog2(last - runEnd), true);
+        mergeSortedRuns(first, runEnd, last);
+        return true;
+    }
+
+    /**
+     * Merges the sorted runs [first, middle) and [middle, last) through a buffer holding the left run.
+     * Time complexity: O(n)
+     */
+    static void mergeSortedRuns(T* first, T* middle, T* last) {
+        if (!(*middle < *(middle - 1))) return;
+
+        Vektor<T> buffer;
+        buffer.insertEnd(first, middle);
+        const T* left = buffer.begin();
+        const T* leftEnd = buffer.end();
+        T* right = middle;
+        T* out = first;
+        while (left != leftEnd && right != last) {
+            if (*right < *left) *out++ = std::move(*right++);
+            else *out++ = std::move(*left++);
+        }
+        while (left != leftEnd) *out++ = std::move(*left++);
+    }
+
+    /**
+     * Main loop: partitions, detects bad or already-partitioned splits, recurses into the smaller side.
+     * badAllowed counts how many highly unbalanced partitions are tolerated before switching to heapsort.
+     * leftmost is false when *(begin - 1) holds a pivot that is not greater than any element of the range.
+     */
+    static void sortLoop(T* begin, T* end, int badAllowed, bool leftmost) {
+        while (true) {
+            const std::ptrdiff_t size = end - begin;
+            if (size < INSERTION_SORT_THRESHOLD) {
+                BinaryInsertionSort<T>::sort(begin, end);
+                return;
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            if (size > NINTHER_THRESHOLD) {
+                sort3(begin, begin + half, end - 1);
+                sort3(begin + 1, begin + (half - 1), end - 2);
+                sort3(begin + 2, begin + (half + 1), end - 3);
+                sort3(begin + (half - 1), begin + half, begin + (half + 1));
+                std::iter_swap(begin, begin + half);
+            } else {
+                sort3(begin + half, begin, end - 1);
+            }
+
+            // Pivot equals the previous one: everything equal to it is already in place.
+            if (!leftmost && !(*(begin - 1) < *begin)) {
+                begin = partitionLeft(begin, end) + 1;
+                continue;
+            }
+
+            auto [pivotPos, alreadyPartitioned] = partitionRight(begin, end);
+            const std::ptrdiff_t leftSize = pivotPos - begin;
+            const std::ptrdiff_t rightSize = end - (pivotPos + 1);
+            const bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+            if (highlyUnbalanced) {
+                if (--badAllowed == 0) {
+                    heapSort(begin, end);
+                    return;
+                }
+                breakPatterns(begin, pivotPos, leftSize);
+                breakPatterns(pivotPos + 1, end, rightSize);
+            } else if (alreadyPartitioned && partialInsertionSort(begin, pivotPos)
+                       && partialInsertionSort(pivotPos + 1, end)) {
+                return;
+            }
+
+            if (leftSize < rightSize) {
+                sortLoop(begin, pivotPos, badAllowed, leftmost);
+                begin = pivotPos + 1;
+                leftmost = false;
+            } else {
+                sortLoop(pivotPos + 1, end, badAllowed, false);
+                end = pivotPos;
+            }
+        }
+    }
+
+    /**
+     * Partitions around *begin into [< pivot] pivot [>= pivot] and returns the pivot position.
+     * alreadyPartitioned is true when no element had to be swapped.
+     * Relies on the median-of-three leaving an element >= pivot at end - 1.
+     */
+    static std::pair<T*, bool> partitionRight(T* begin, T* end) {
+        T pivot = std::move(*begin);
+        T* first = begin;
+        T* last = end;
+
+        while (*++first < pivot);
+        if (first - 1 == begin) {
+            while (first < last && !(*--last < pivot));
+        } else {
+            while (!(*--last < pivot));
+        }
+
+        const bool alreadyPartitioned = first >= last;
+        while (first < last) {
+            std::iter_swap(first, last);
+            while (*++first < pivot);
+            while (!(*--last < pivot));
+        }
+
+        T* pivotPos = first - 1;
+        *begin = std::move(*pivotPos);
+        *pivotPos = std::move(pivot);
+        return {pivotPos, alreadyPartitioned};
+    }
+
+    /**
+     * Partitions into [<= pivot] pivot [> pivot]; used when the pivot equals the preceding pivot,
+     * so the whole left part consists of elements equal to it.
+     */
+    static T* partitionLeft(T* begin, T* end) {
+        T pivot = std::move(*begin);
+        T* first = begin;
+        T* last = end;
+
+        while (pivot < *--last);
+        if (last + 1 == end) {
+            while (first < last && !(pivot < *++first));
+        } else {
+            while (!(pivot < *++first));
+        }
+
+        while (first < last) {
+            std::iter_swap(first, last);
+            while (pivot < *--last);
+            while (!(pivot < *++first));
+        }
+
+        T* pivotPos = last;
+        *begin = std::move(*pivotPos);
+        *pivotPos = std::move(pivot);
+        return pivotPos;
+    }
+
+    /**
+     * Insertion sort that gives up after PARTIAL_INSERTION_SORT_LIMIT element moves.
+     * Returns true if the range ended up sorted.
+     */
+    static bool partialInsertionSort(T* begin, T* end) {
+        if (begin == end) return true;
+
+        std::ptrdiff_t moves = 0;
+        for (T* current = begin + 1; current != end; ++current) {
+            T* sift = current;
+            T* siftPrevious = current - 1;
+            if (*sift < *siftPrevious) {
+                T value = std::move(*sift);
+                do {
+                    *sift-- = std::move(*siftPrevious);
+                } while (sift != begin && value < *--siftPrevious);
+                *sift = std::move(value);
+                moves += current - sift;
+                if (moves > PARTIAL_INSERTION_SORT_LIMIT) return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Swaps a few elements at fixed offsets after an unbalanced partition, so inputs crafted
+     * against the pivot rule do not keep producing bad splits.
+     */
+    static void breakPatterns(T* begin, T* end, const std::ptrdiff_t size) {
+        if (size < INSERTION_SORT_THRESHOLD) return;
+
+        const std::ptrdiff_t quarter = size / 4;
+        std::iter_swap(begin, begin + quarter);
+        std::iter_swap(end - 1, end - quarter);
+        if (size > NINTHER_THRESHOLD) {
+            std::iter_swap(begin + 1, begin + (quarter + 1));
+            std::iter_swap(begin + 2, begin + (quarter + 2));
+            std::iter_swap(end - 2, end - (quarter + 1));
+            std::iter_swap(end - 3, end - (quarter + 2));
+        }
+    }
+
+    static void heapSort(T* begin, T* end) {
+        const std::ptrdiff_t size = end - begin;
+        for (std::ptrdiff_t i = size / 2 - 1; i >= 0; --i)
+            siftDown(begin, i, size);
+        for (std::ptrdiff_t last = size - 1; last > 0; --last) {
+            std::iter_swap(begin, begin + last);
+            siftDown(begin, 0, last);
+        }
+    }
+
+    static void siftDown(T* heap, std::ptrdiff_t root, const std::ptrdiff_t heapSize) {
+        T value = std::move(heap[root]);
+        std::ptrdiff_t child;
+        while ((child = 2 * root + 1) < heapSize) {
+            if (child + 1 < heapSize && heap[child] < heap[child + 1]) ++child;
+            if (!(value < heap[child])) break;
+            heap[root] = std::move(heap[child]);
+            root = child;
+        }
+        heap[root] = std::move(value);
+    }
+
+    static void sort2(T* a, T* b) {
+        if (*b < *a) std::iter_swap(a, b);
+    }
+
+    /// Orders *a <= *b <= *c.
+    static void sort3(T* a, T* b, T* c) {
+        sort2(a, b);
+        sort2(b, c);
+        sort2(a, b);
+    }
+};
+
+#endif
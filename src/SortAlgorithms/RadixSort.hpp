@@ -0,0 +1,116 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Maps a value to an unsigned key whose unsigned order equals the value order.
+ * Specialized for the element types the sort benchmarks use.
+ */
+template <typename T>
+struct RadixKey;
+
+template <>
+struct RadixKey<int> {
+    using Key = std::uint32_t;
+
+    /// Flips the sign bit, so negative numbers come before positive ones.
+    static Key toKey(int value) {
+        return static_cast<Key>(value) ^ 0x80000000u;
+    }
+};
+
+template <>
+struct RadixKey<float> {
+    using Key = std::uint32_t;
+
+    /// Positive floats get the sign bit set; negative floats are fully inverted, which reverses their order.
+    static Key toKey(float value) {
+        Key bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+};
+
+template <>
+struct RadixKey<double> {
+    using Key = std::uint64_t;
+
+    static Key toKey(double value) {
+        Key bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+    }
+};
+
+/**
+ * Least-significant-digit radix sort on a raw [first, last) range with 11-bit digits,
+ * i.e. 3 passes for 32-bit keys and 6 passes for 64-bit keys.
+ *
+ * - histograms of all digits are built in a single read of the input;
+ * - a pass whose digit is the same for every element is skipped;
+ * - elements ping-pong between the range and one scratch buffer of the same size.
+ *
+ * Keys come from RadixKey<T>, so -0.0 sorts before +0.0 and NaNs end up at the ends.
+ */
+template <typename T>
+class RadixSort {
+    using Key = typename RadixKey<T>::Key;
+
+    static constexpr int DIGIT_BITS = 11;
+    static constexpr int BUCKETS = 1 << DIGIT_BITS;
+    static constexpr Key DIGIT_MASK = BUCKETS - 1;
+    static constexpr int PASSES = (static_cast<int>(sizeof(Key)) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+
+public:
+    /**
+     * Sorts [first, last) in ascending order, stable.
+     * Time complexity: O(PASSES * (n + 2^DIGIT_BITS)), additional memory O(n)
+     */
+    static void sort(T* first, T* last) {
+        const int size = static_cast<int>(last - first);
+        if (size < 2) return;
+
+        Vektor<int> counts(PASSES * BUCKETS);
+        for (const T* element = first; element != last; ++element) {
+            const Key key = RadixKey<T>::toKey(*element);
+            for (int pass = 0; pass < PASSES; ++pass)
+                ++counts[pass * BUCKETS + digit(key, pass)];
+        }
+
+        Vektor<T> scratch(size);
+        T* source = first;
+        T* destination = scratch.begin();
+        for (int pass = 0; pass < PASSES; ++pass) {
+            int* bucketStart = counts.begin() + pass * BUCKETS;
+            if (bucketStart[digit(RadixKey<T>::toKey(*source), pass)] == size)
+                continue;
+
+            int offset = 0;
+            for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+                const int count = bucketStart[bucket];
+                bucketStart[bucket] = offset;
+                offset += count;
+            }
+            for (const T* element = source; element != source + size; ++element)
+                destination[bucketStart[digit(RadixKey<T>::toKey(*element), pass)]++] = *element;
+
+            std::swap(source, destination);
+        }
+
+        if (source != first)
+            std::copy(source, source + size, first);
+    }
+
+private:
+    static int digit(Key key, int pass) {
+        return static_cast<int>((key >> (pass * DIGIT_BITS)) & DIGIT_MASK);
+    }
+};
+
+#endif
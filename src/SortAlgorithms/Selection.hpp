@@ -0,0 +1,179 @@
+#ifndef SELECTION_HPP
+#define SELECTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+/**
+ * Selection algorithms on raw ranges, for order statistics and top-k queries that do not need a full sort.
+ *
+ * - nthElement: Floyd-Rivest selection. For large ranges it first recurses on a small sample that brackets
+ *   the target rank, so the pivot lands within a few elements of it and one partition pass almost finishes
+ *   the job (about n + min(k, n - k) comparisons). After too many partitioning rounds it falls back to heap
+ *   selection, which bounds the worst case at O(n log n), as in introselect.
+ * - partialSort: sorts the k smallest elements with a bounded max-heap, O(n log k).
+ * - topK: copies the k largest elements in descending order with a bounded min-heap, input untouched.
+ * Requires T to provide operator<.
+ */
+template <typename T>
+class Selection {
+public:
+    /**
+     * Rearranges [first, last) so that *nth is the element a full sort would put there, everything before it
+     * is not greater and everything after it is not smaller.
+     * Time complexity: O(n) average, O(n log n) worst case.
+     */
+    static void nthElement(T* first, T* nth, T* last) {
+        if (last - first < 2 || nth < first || nth >= last) return;
+        const std::ptrdiff_t size = last - first;
+        floydRivest(first, 0, size - 1, nth - first, 2 * floorLog2(size) + 4);
+    }
+
+    /**
+     * Sorts the smallest middle - first elements of [first, last) into [first, middle); the rest is unordered.
+     * Time complexity: O(n log k) with k = middle - first.
+     */
+    static void partialSort(T* first, T* middle, T* last) {
+        if (middle <= first) return;
+        const auto less = [](const T& a, const T& b) { return a < b; };
+        selectIntoHeap(first, middle, last, less);
+        sortHeap(first, middle - first, less);
+    }
+
+    /**
+     * Writes the k largest elements of [first, last) to output in descending order; k is clamped to the size.
+     * Returns the number of elements written.
+     * Time complexity: O(n log k)
+     */
+    static std::ptrdiff_t topK(const T* first, const T* last, std::ptrdiff_t k, T* output) {
+        k = std::min(k, last - first);
+        if (k <= 0) return 0;
+        const auto greater = [](const T& a, const T& b) { return b < a; };
+        std::copy(first, first + k, output);
+        makeHeap(output, k, greater);
+        for (const T* current = first + k; current != last; ++current) {
+            if (output[0] < *current)
+                siftDown(output, 0, k, *current, greater);
+        }
+        sortHeap(output, k, greater);
+        return k;
+    }
+
+private:
+    /// Ranges above this size are narrowed with a recursive sample before partitioning.
+    static constexpr std::ptrdiff_t SAMPLING_THRESHOLD = 600;
+
+    static int floorLog2(std::ptrdiff_t n) {
+        int log = 0;
+        while (n >>= 1) ++log;
+        return log;
+    }
+
+    /**
+     * Floyd-Rivest SELECT on the inclusive range [left, right] of data.
+     * Time complexity: O(n) average; rounds is the partition budget before heap selection takes over.
+     */
+    static void floydRivest(T* data, std::ptrdiff_t left, std::ptrdiff_t right, std::ptrdiff_t k, int rounds) {
+        while (right > left) {
+            if (rounds-- == 0) {
+                const auto less = [](const T& a, const T& b) { return a < b; };
+                T* nth = data + k;
+                selectIntoHeap(data + left, nth + 1, data + right + 1, less);
+                std::iter_swap(data + left, nth);
+                return;
+            }
+
+            if (right - left > SAMPLING_THRESHOLD) {
+                // Select inside a sample of about n^(2/3) elements around the expected position of rank k.
+                const double n = static_cast<double>(right - left + 1);
+                const double i = static_cast<double>(k - left + 1);
+                const double z = std::log(n);
+                const double s = 0.5 * std::exp(2.0 * z / 3.0);
+                const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i - n / 2.0 < 0 ? -1.0 : 1.0);
+                const auto newLeft = std::max(left, static_cast<std::ptrdiff_t>(static_cast<double>(k) - i * s / n + sd));
+                const auto newRight = std::min(right,
+                    static_cast<std::ptrdiff_t>(static_cast<double>(k) + (n - i) * s / n + sd));
+                floydRivest(data, newLeft, newRight, k, rounds);
+            }
+
+            // Hoare partition around t = data[k]; equal elements stop both scans, so duplicates split evenly.
+            const T pivot = data[k];
+            std::ptrdiff_t i = left;
+            std::ptrdiff_t j = right;
+            std::swap(data[left], data[k]);
+            if (pivot < data[right])
+                std::swap(data[right], data[left]);
+            while (i < j) {
+                std::swap(data[i], data[j]);
+                ++i;
+                --j;
+                while (data[i] < pivot) ++i;
+                while (pivot < data[j]) --j;
+            }
+            if (!(data[left] < pivot) && !(pivot < data[left])) {
+                std::swap(data[left], data[j]);
+            } else {
+                ++j;
+                std::swap(data[j], data[right]);
+            }
+
+            if (j <= k) left = j + 1;
+            if (k <= j) right = j - 1;
+        }
+    }
+
+    /**
+     * Leaves the middle - first smallest elements of [first, last) (by less) in [first, middle) as a max-heap.
+     * Time complexity: O(n log k)
+     */
+    template <typename Less>
+    static void selectIntoHeap(T* first, T* middle, T* last, Less less) {
+        const std::ptrdiff_t heapSize = middle - first;
+        makeHeap(first, heapSize, less);
+        for (T* current = middle; current < last; ++current) {
+            if (less(*current, first[0])) {
+                T value = std::move(*current);
+                *current = std::move(first[0]);
+                siftDown(first, 0, heapSize, std::move(value), less);
+            }
+        }
+    }
+
+    template <typename Less>
+    static void makeHeap(T* heap, std::ptrdiff_t size, Less less) {
+        for (std::ptrdiff_t node = size / 2 - 1; node >= 0; --node) {
+            T value = std::move(heap[node]);
+            siftDown(heap, node, size, std::move(value), less);
+        }
+    }
+
+    /// Turns a heap ordered by less into a range sorted ascending by less.
+    template <typename Less>
+    static void sortHeap(T* heap, std::ptrdiff_t size, Less less) {
+        for (std::ptrdiff_t end = size - 1; end > 0; --end) {
+            T value = std::move(heap[end]);
+            heap[end] = std::move(heap[0]);
+            siftDown(heap, 0, end, std::move(value), less);
+        }
+    }
+
+    /// Places value into the hole at index hole, moving larger children (by less) up.
+    template <typename Less>
+    static void siftDown(T* heap, std::ptrdiff_t hole, std::ptrdiff_t size, T value, Less less) {
+        std::ptrdiff_t child = 2 * hole + 1;
+        while (child < size) {
+            if (child + 1 < size && less(heap[child], heap[child + 1]))
+                ++child;
+            if (!less(value, heap[child]))
+                break;
+            heap[hole] = std::move(heap[child]);
+            hole = child;
+            child = 2 * hole + 1;
+        }
+        heap[hole] = std::move(value);
+    }
+};
+
+#endif
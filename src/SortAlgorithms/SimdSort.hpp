@@ -0,0 +1,340 @@
+#ifndef SIMD_SORT_HPP
+#define SIMD_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "../VektorImpl/Vektor.hpp"
+#include "PatternDefeatingSort.hpp"
+#include "../common/SimdSupport.hpp"
+
+#ifdef SIMD_X86
+
+/**
+ * Lane-level permutation tables shared by the AVX2 kernels. All permutations are expressed as
+ * 8 x int32 indices for _mm256_permutevar8x32, so 64-bit lanes use pairs of 32-bit indices.
+ */
+template <int Lanes>
+struct SimdSortTables {
+    static constexpr int WIDTH = 8 / Lanes;
+    static constexpr int MASKS = 1 << Lanes;
+
+    /// compress[m] moves the lanes whose bit is set in m to the front, keeping their order.
+    static constexpr std::array<std::array<int, 8>, MASKS> compress = []() {
+        std::array<std::array<int, 8>, MASKS> table{};
+        for (int mask = 0; mask < MASKS; ++mask) {
+            int slot = 0;
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int lane = 0; lane < Lanes; ++lane) {
+                    if (((mask >> lane) & 1) != (pass == 0 ? 1 : 0)) continue;
+                    for (int part = 0; part < WIDTH; ++part)
+                        table[mask][slot * WIDTH + part] = lane * WIDTH + part;
+                    ++slot;
+                }
+            }
+        }
+        return table;
+    }();
+
+    /// Compare-exchange steps of a bitonic network: partner lane i ^ distance, lanes with takeMax keep the larger value.
+    struct Step {
+        std::array<int, 8> partner;
+        std::array<int, 8> takeMax;
+    };
+
+    static constexpr Step makeStep(int blockSize, int distance, bool merging) {
+        Step step{};
+        for (int lane = 0; lane < Lanes; ++lane) {
+            const bool ascending = merging || (lane & blockSize) == 0;
+            const bool lower = (lane & distance) == 0;
+            for (int part = 0; part < WIDTH; ++part) {
+                step.partner[lane * WIDTH + part] = (lane ^ distance) * WIDTH + part;
+                step.takeMax[lane * WIDTH + part] = (lower != ascending) ? -1 : 0;
+            }
+        }
+        return step;
+    }
+
+    static constexpr int SORT_STEPS = Lanes == 8 ? 6 : 3;
+    static constexpr int MERGE_STEPS = Lanes == 8 ? 3 : 2;
+
+    /// Full bitonic sort of one register.
+    static constexpr std::array<Step, SORT_STEPS> sortSteps = []() {
+        std::array<Step, SORT_STEPS> steps{};
+        int count = 0;
+        for (int blockSize = 2; blockSize <= Lanes; blockSize *= 2)
+            for (int distance = blockSize / 2; distance > 0; distance /= 2)
+                steps[count++] = makeStep(blockSize, distance, false);
+        return steps;
+    }();
+
+    /// Ascending bitonic merge of one register holding a bitonic sequence.
+    static constexpr std::array<Step, MERGE_STEPS> mergeSteps = []() {
+        std::array<Step, MERGE_STEPS> steps{};
+        int count = 0;
+        for (int distance = Lanes / 2; distance > 0; distance /= 2)
+            steps[count++] = makeStep(Lanes, distance, true);
+        return steps;
+    }();
+
+    static constexpr std::array<int, 8> reverse = []() {
+        std::array<int, 8> indices{};
+        for (int lane = 0; lane < Lanes; ++lane)
+            for (int part = 0; part < WIDTH; ++part)
+                indices[lane * WIDTH + part] = (Lanes - 1 - lane) * WIDTH + part;
+        return indices;
+    }();
+};
+
+/**
+ * AVX2 operations for one element type. Only int, float and double are specialized;
+ * the members of the primary template only keep SimdSort<T> declarable for other types.
+ */
+template <typename T>
+struct SimdLanes {
+    static constexpr bool supported = false;
+    static constexpr int LANES = 8;
+    using Vec = int;
+};
+
+template <>
+struct SimdLanes<int> {
+    static constexpr bool supported = true;
+    static constexpr int LANES = 8;
+    using Vec = __m256i;
+
+    SIMD_AVX2 static Vec load(const int* source) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)); }
+    SIMD_AVX2 static void store(int* destination, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), v); }
+    SIMD_AVX2 static Vec broadcast(int value) { return _mm256_set1_epi32(value); }
+    SIMD_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+    SIMD_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+    SIMD_AVX2 static Vec permute(Vec v, __m256i indices) { return _mm256_permutevar8x32_epi32(v, indices); }
+    SIMD_AVX2 static Vec select(Vec ifZero, Vec ifSet, __m256i mask) { return _mm256_blendv_epi8(ifZero, ifSet, mask); }
+    /// Bit i is set when lane i is < pivot (orEqual: <= pivot).
+    SIMD_AVX2 static int belowMask(Vec v, Vec pivot, bool orEqual) {
+        const int greater = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pivot)));
+        const int less = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v)));
+        return orEqual ? (~greater & 0xFF) : less;
+    }
+};
+
+template <>
+struct SimdLanes<float> {
+    static constexpr bool supported = true;
+    static constexpr int LANES = 8;
+    using Vec = __m256;
+
+    SIMD_AVX2 static Vec load(const float* source) { return _mm256_loadu_ps(source); }
+    SIMD_AVX2 static void store(float* destination, Vec v) { _mm256_storeu_ps(destination, v); }
+    SIMD_AVX2 static Vec broadcast(float value) { return _mm256_set1_ps(value); }
+    SIMD_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+    SIMD_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+    SIMD_AVX2 static Vec permute(Vec v, __m256i indices) { return _mm256_permutevar8x32_ps(v, indices); }
+    SIMD_AVX2 static Vec select(Vec ifZero, Vec ifSet, __m256i mask) {
+        return _mm256_blendv_ps(ifZero, ifSet, _mm256_castsi256_ps(mask));
+    }
+    SIMD_AVX2 static int belowMask(Vec v, Vec pivot, bool orEqual) {
+        return orEqual ? _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LE_OQ))
+                       : _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LT_OQ));
+    }
+};
+
+template <>
+struct SimdLanes<double> {
+    static constexpr bool supported = true;
+    static constexpr int LANES = 4;
+    using Vec = __m256d;
+
+    SIMD_AVX2 static Vec load(const double* source) { return _mm256_loadu_pd(source); }
+    SIMD_AVX2 static void store(double* destination, Vec v) { _mm256_storeu_pd(destination, v); }
+    SIMD_AVX2 static Vec broadcast(double value) { return _mm256_set1_pd(value); }
+    SIMD_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+    SIMD_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+    SIMD_AVX2 static Vec permute(Vec v, __m256i indices) {
+        return _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), indices));
+    }
+    SIMD_AVX2 static Vec select(Vec ifZero, Vec ifSet, __m256i mask) {
+        return _mm256_blendv_pd(ifZero, ifSet, _mm256_castsi256_pd(mask));
+    }
+    SIMD_AVX2 static int belowMask(Vec v, Vec pivot, bool orEqual) {
+        return orEqual ? _mm256_movemask_pd(_mm256_cmp_pd(v, pivot, _CMP_LE_OQ))
+                       : _mm256_movemask_pd(_mm256_cmp_pd(v, pivot, _CMP_LT_OQ));
+    }
+};
+
+#else
+
+template <typename T>
+struct SimdLanes {
+    static constexpr bool supported = false;
+};
+
+#endif
+
+/**
+ * Quicksort built from AVX2 kernels for int, float and double on a raw [first, last) range:
+ * - partition: 8 (double: 4) elements per step are compared with the pivot at once and compressed
+ *   with a permutation table; elements below the pivot are written back in place, the rest go to
+ *   one scratch buffer and are copied behind them;
+ * - ranges of at most two registers are finished by an in-register bitonic sorting network.
+ *
+ * Works on raw pointers, so checked Vektor access does not get in the way of vectorization.
+ * Other types, and CPUs without AVX2, use the scalar pattern-defeating quicksort.
+ * Float data must be NaN-free.
+ */
+template <typename T>
+class SimdSort {
+public:
+    /// True when sort() runs the vector kernels on this CPU.
+    static bool isVectorized() {
+        return SimdLanes<T>::supported && SimdSupport::hasAvx2();
+    }
+
+    /**
+     * Sorts [first, last) in ascending order, not stable.
+     * Time complexity: O(n log n) average; falls back to pattern-defeating quicksort after 2 log n levels.
+     */
+    static void sort(T* first, T* last) {
+#ifdef SIMD_X86
+        if constexpr (SimdLanes<T>::supported) {
+            if (SimdSupport::hasAvx2()) {
+                const std::ptrdiff_t size = last - first;
+                if (size < 2) return;
+                Vektor<T> scratch(static_cast<int>(size) + SimdLanes<T>::LANES);
+                sortLoop(first, last, scratch.begin(), 2 * floorLog2(size));
+                return;
+            }
+        }
+#endif
+        PatternDefeatingSort<T>::sort(first, last);
+    }
+
+#ifdef SIMD_X86
+private:
+    using Lanes = SimdLanes<T>;
+    using Tables = SimdSortTables<Lanes::LANES>;
+    static constexpr int LANES = Lanes::LANES;
+    static constexpr int NETWORK_SIZE = 2 * LANES;
+
+    static int floorLog2(std::ptrdiff_t n) {
+        int log = 0;
+        while (n >>= 1) ++log;
+        return log;
+    }
+
+    SIMD_AVX2 static void sortLoop(T* first, T* last, T* scratch, int depthLimit) {
+        while (last - first > NETWORK_SIZE) {
+            if (depthLimit-- == 0) {
+                PatternDefeatingSort<T>::sort(first, last);
+                return;
+            }
+            const T pivot = medianOfThree(*first, first[(last - first) / 2], *(last - 1));
+            T* middle = partition(first, last, pivot, scratch, false);
+            if (middle == first) {
+                // Nothing is below the pivot, so it is the minimum: split off all copies of it.
+                first = partition(first, last, pivot, scratch, true);
+                continue;
+            }
+            if (middle - first < last - middle) {
+                sortLoop(first, middle, scratch, depthLimit);
+                first = middle;
+            } else {
+                sortLoop(middle, last, scratch, depthLimit);
+                last = middle;
+            }
+        }
+        sortNetwork(first, static_cast<int>(last - first));
+    }
+
+    /**
+     * Reorders [first, last) into [< pivot][>= pivot] (orEqual: [<= pivot][> pivot]) and returns the split point.
+     * The in-place store of a block never reaches past the block just loaded, so unread input is never overwritten.
+     */
+    SIMD_AVX2 static T* partition(T* first, T* last, T pivot, T* scratch, bool orEqual) {
+        const typename Lanes::Vec pivots = Lanes::broadcast(pivot);
+        const int fullMask = (1 << LANES) - 1;
+        T* below = first;
+        T* above = scratch;
+        T* current = first;
+        for (; current + LANES <= last; current += LANES) {
+            const typename Lanes::Vec values = Lanes::load(current);
+            const int mask = Lanes::belowMask(values, pivots, orEqual);
+            const int belowCount = __builtin_popcount(static_cast<unsigned>(mask));
+            Lanes::store(below, Lanes::permute(values, loadIndices(Tables::compress[mask])));
+            Lanes::store(above, Lanes::permute(values, loadIndices(Tables::compress[~mask & fullMask])));
+            below += belowCount;
+            above += LANES - belowCount;
+        }
+        for (; current != last; ++current) {
+            const T value = *current;
+            if (orEqual ? !(pivot < value) : value < pivot) *below++ = value;
+            else *above++ = value;
+        }
+        std::copy(scratch, above, below);
+        return below;
+    }
+
+    /// Sorts up to NETWORK_SIZE elements: two bitonic-sorted registers merged by a bitonic merge.
+    SIMD_AVX2 static void sortNetwork(T* first, int count) {
+        if (count < 2) return;
+        alignas(32) T buffer[NETWORK_SIZE];
+        std::fill(buffer, buffer + NETWORK_SIZE, sentinel());
+        std::copy(first, first + count, buffer);
+
+        typename Lanes::Vec low = sortRegister(Lanes::load(buffer));
+        typename Lanes::Vec high = sortRegister(Lanes::load(buffer + LANES));
+        high = Lanes::permute(high, loadIndices(Tables::reverse));
+        const typename Lanes::Vec smaller = Lanes::min(low, high);
+        const typename Lanes::Vec larger = Lanes::max(low, high);
+        Lanes::store(buffer, mergeRegister(smaller));
+        Lanes::store(buffer + LANES, mergeRegister(larger));
+
+        std::copy(buffer, buffer + count, first);
+    }
+
+    SIMD_AVX2 static typename Lanes::Vec sortRegister(typename Lanes::Vec values) {
+        for (const auto& step : Tables::sortSteps)
+            values = compareExchange(values, step);
+        return values;
+    }
+
+    SIMD_AVX2 static typename Lanes::Vec mergeRegister(typename Lanes::Vec values) {
+        for (const auto& step : Tables::mergeSteps)
+            values = compareExchange(values, step);
+        return values;
+    }
+
+    SIMD_AVX2 static typename Lanes::Vec compareExchange(typename Lanes::Vec values,
+                                                              const typename Tables::Step& step) {
+        const typename Lanes::Vec partner = Lanes::permute(values, loadIndices(step.partner));
+        return Lanes::select(Lanes::min(values, partner), Lanes::max(values, partner), loadIndices(step.takeMax));
+    }
+
+    SIMD_AVX2 static __m256i loadIndices(const std::array<int, 8>& indices) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices.data()));
+    }
+
+    /// Padding value for partially filled networks; sorts after every NaN-free element.
+    static T sentinel() {
+        if constexpr (std::numeric_limits<T>::has_infinity)
+            return std::numeric_limits<T>::infinity();
+        else
+            return std::numeric_limits<T>::max();
+    }
+
+    static T medianOfThree(const T& a, const T& b, const T& c) {
+        if (a < b) {
+            if (b < c) return b;
+            return a < c ? c : a;
+        }
+        if (a < c) return a;
+        return b < c ? c : b;
+    }
+#endif
+};
+
+#endif
@@ -1,17 +1,34 @@
 #ifndef SORTALGORITHMS_H
 #define SORTALGORITHMS_H
 
+#include <algorithm>
+#include <random>
+#include <utility>
+
 #include "../VektorImpl/Vektor.hpp"
+#include "PatternDefeatingSort.hpp"
+#include "RadixSort.hpp"
+#include "SimdSort.hpp"
+#include "BlockQuickSort.hpp"
+#include "TimSort.hpp"
+#include "BottomUpHeapSort.hpp"
+#include "BinaryInsertionSort.hpp"
+#include "Selection.hpp"
 
-template <typename T>
+/**
+ * Classic sorting algorithms on Vektor storage.
+ * AccessPolicy selects checked or unchecked element access of the sorted container.
+ */
+template <typename T, typename AccessPolicy = DefaultAccessPolicy>
 class SortAlgorithms {
 public:
+    using Container = Vektor<T, DoublingGrowth, AccessPolicy>;
 
     /**
      * Sorts the vector using simple insertion sort.
      * Runs in O(n^2) time on average, suitable for small datasets.
      */
-    static void insertionSort(Vektor<T>& data_to_sort) {
+    static void insertionSort(Container& data_to_sort) {
         const int n = data_to_sort.size();
         for (int i = 1; i < n; i++) {
             T key = data_to_sort[i];
@@ -28,7 +45,7 @@ public:
      * Sorts the vector using binary insertion sort.
      * Uses binary search to locate insertion point, reducing comparisons.
      */
-    static void binaryInsertionSort(Vektor<T>& data_to_sort) {
+    static void binaryInsertionSort(Container& data_to_sort) {
         const int n = data_to_sort.size();
         for (int i = 1; i < n; i++) {
             T key = data_to_sort[i];
@@ -47,11 +64,20 @@ public:
         }
     }
 
+    /**
+     * Sorts the vector using binary insertion sort with a galloping search from the tail
+     * and block moves (see BinaryInsertionSort).
+     * O(n log n) comparisons and O(n^2) moves, close to O(n) on nearly sorted data.
+     */
+    static void gallopingInsertionSort(Container& data_to_sort) {
+        BinaryInsertionSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
     /**
      * Sorts the vector using heap sort.
      * Builds a max heap then repeatedly extracts the maximum element.
      */
-    static void heapSort(Vektor<T>& data_to_sort) {
+    static void heapSort(Container& data_to_sort) {
         const int n = data_to_sort.size();
         buildMaxHeap(data_to_sort);
         for (int i = n - 1; i >= 1; i--) {
@@ -66,16 +92,122 @@ public:
      * Sorts the vector using randomized quick sort.
      * Average O(n log n), uses randomized pivot selection.
      */
-    static void quickSort(Vektor<T>& data_to_sort) {
+    static void quickSort(Container& data_to_sort) {
         if (data_to_sort.size() > 1)
             recurciveQuickSort(data_to_sort, 0, data_to_sort.size() - 1);
     }
 
+    /**
+     * Sorts the vector using quick sort with three-way (Dutch national flag) partitioning.
+     * Elements equal to the pivot are grouped in the middle and never revisited,
+     * so inputs with few distinct values sort in O(n * distinct) instead of degrading to O(n^2).
+     */
+    static void threeWayQuickSort(Container& data_to_sort) {
+        if (data_to_sort.size() > 1)
+            recursiveThreeWayQuickSort(data_to_sort, 0, data_to_sort.size() - 1);
+    }
+
+    /**
+     * Sorts the vector using pattern-defeating quicksort (see PatternDefeatingSort).
+     * O(n log n) worst case, near-linear on sorted, reversed and long presorted-prefix inputs.
+     */
+    static void patternDefeatingSort(Container& data_to_sort) {
+        PatternDefeatingSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using LSD radix sort (see RadixSort); only for int, float and double.
+     * O(n) per digit pass, independent of the input order.
+     */
+    static void radixSort(Container& data_to_sort) {
+        RadixSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using quicksort with AVX2 partition and sorting-network kernels (see SimdSort).
+     * Falls back to pattern-defeating quicksort without AVX2. O(n log n) average.
+     */
+    static void simdQuickSort(Container& data_to_sort) {
+        SimdSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using binary heap sort with bottom-up sift-down (see BottomUpHeapSort).
+     * O(n log n), iterative and with about half the comparisons of heapSort().
+     */
+    static void bottomUpHeapSort(Container& data_to_sort) {
+        BottomUpHeapSort<T, 2>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using 4-ary heap sort with bottom-up sift-down and grandchild prefetching.
+     * O(n log n), half as many levels as a binary heap, which pays off once the heap exceeds the cache.
+     */
+    static void quaternaryHeapSort(Container& data_to_sort) {
+        BottomUpHeapSort<T, 4>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using quick sort with branchless block partitioning (see BlockQuickSort).
+     * O(n log n), with far fewer branch mispredictions than partition() on random input.
+     */
+    static void blockQuickSort(Container& data_to_sort) {
+        BlockQuickSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Sorts the vector using stable natural merge sort with galloping (see TimSort).
+     * O(n log n) worst case, close to O(n) on sorted, reversed and partially sorted input.
+     */
+    static void timSort(Container& data_to_sort) {
+        TimSort<T>::sort(data_to_sort.begin(), data_to_sort.end());
+    }
+
+    /**
+     * Moves the element of rank k (0-based) to index k, with no greater elements before it
+     * and no smaller after it (see Selection).
+     * O(n) average, O(n log n) worst case.
+     */
+    static void nthElement(Container& data, int k) {
+        Selection<T>::nthElement(data.begin(), data.begin() + k, data.end());
+    }
+
+    /**
+     * Sorts the k smallest elements into the first k positions; the rest stays unordered.
+     * O(n log k)
+     */
+    static void partialSort(Container& data, int k) {
+        Selection<T>::partialSort(data.begin(), data.begin() + std::min(k, data.size()), data.end());
+    }
+
+    /**
+     * Returns the k largest elements in descending order without modifying the data.
+     * O(n log k)
+     */
+    static Vektor<T> topK(const Container& data, int k) {
+        Vektor<T> result(std::max(0, std::min(k, data.size())));
+        Selection<T>::topK(data.begin(), data.end(), result.size(), result.begin());
+        return result;
+    }
+
+    /**
+     * Returns the median (mean of the two middle elements for an even size) and reorders the data.
+     * O(n) average, replaces a full sort when only the median is needed.
+     */
+    static double median(Container& data) {
+        const int n = data.size();
+        if (n == 0) return 0.0;
+        nthElement(data, n / 2);
+        if (n % 2 == 1) return static_cast<double>(data[n / 2]);
+        const T lower = *std::max_element(data.begin(), data.begin() + n / 2);
+        return (static_cast<double>(lower) + static_cast<double>(data[n / 2])) / 2.0;
+    }
+
 private:
     /**
     * Ensures subtree rooted at index i satisfies max-heap property.
     */
-    static void maxHeapify(Vektor<T>& data_to_sort, int i, int heapSize) {
+    static void maxHeapify(Container& data_to_sort, int i, int heapSize) {
         int largest = i;
         int left = 2 * i + 1;
         int right = 2 * i + 2;
@@ -94,7 +226,7 @@ private:
     /**
      * Builds a max-heap from the unsorted vector.
      */
-    static void buildMaxHeap(Vektor<T>& data_to_sort) {
+    static void buildMaxHeap(Container& data_to_sort) {
         const int n = data_to_sort.size();
         for (int i = n / 2 - 1; i >= 0; i--)
             maxHeapify(data_to_sort, i, n);
@@ -103,7 +235,7 @@ private:
     /**
     * Partitions the array around a random pivot and returns pivot index.
     */
-    static int partition(Vektor<T>& data_to_sort, int l, int r) {
+    static int partition(Container& data_to_sort, int l, int r) {
         thread_local std::mt19937 gen{std::random_device{}()};
         std::uniform_int_distribution<int> dist(l, r);
         int pivotIndex = dist(gen);
@@ -122,10 +254,59 @@ private:
         return i + 1;
     }
 
+    /**
+    * Splits [l, r] into [< pivot] [== pivot] [> pivot] around a random pivot.
+    * On return [lt, gt] holds the elements equal to the pivot.
+    */
+    static void threeWayPartition(Container& data_to_sort, int l, int r, int& lt, int& gt) {
+        thread_local std::mt19937 gen{std::random_device{}()};
+        std::uniform_int_distribution<> dist(l, r);
+        const T pivot = data_to_sort[dist(gen)];
+        lt = l;
+        gt = r;
+        int i = l;
+        while (i <= gt) {
+            if (data_to_sort[i] < pivot)
+                std::swap(data_to_sort[lt++], data_to_sort[i++]);
+            else if (pivot < data_to_sort[i])
+                std::swap(data_to_sort[i], data_to_sort[gt--]);
+            else
+                ++i;
+        }
+    }
+
+    /**
+    * Recurses into the smaller of the outer parts and loops on the larger one, so stack depth stays O(log n);
+    * short ranges are finished with insertion sort.
+    */
+    static void recursiveThreeWayQuickSort(Container& data_to_sort, int l, int r) {
+        while (r - l >= THREE_WAY_INSERTION_CUTOFF) {
+            int lt, gt;
+            threeWayPartition(data_to_sort, l, r, lt, gt);
+            if (lt - l < r - gt) {
+                recursiveThreeWayQuickSort(data_to_sort, l, lt - 1);
+                l = gt + 1;
+            } else {
+                recursiveThreeWayQuickSort(data_to_sort, gt + 1, r);
+                r = lt - 1;
+            }
+        }
+        insertionSortRange(data_to_sort, l, r);
+    }
+
+    static constexpr int THREE_WAY_INSERTION_CUTOFF = 16;
+
+    /**
+    * Insertion sort of the inclusive range [l, r].
+    */
+    static void insertionSortRange(Container& data_to_sort, int l, int r) {
+        BinaryInsertionSort<T>::sort(data_to_sort.begin() + l, data_to_sort.begin() + r + 1);
+    }
+
     /**
     * Recursively applies quick sort to subranges.
     */
-    static void recurciveQuickSort(Vektor<T>& data_to_sort, int l, int r) {
+    static void recurciveQuickSort(Container& data_to_sort, int l, int r) {
         if (l < r) {
             int p = partition(data_to_sort, l, r);
             recurciveQuickSort(data_to_sort, l, p - 1);
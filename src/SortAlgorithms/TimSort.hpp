@@ -0,0 +1,392 @@
+#ifndef TIM_SORT_HPP
+#define TIM_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "../VektorImpl/Vektor.hpp"
+#include "BinaryInsertionSort.hpp"
+
+/**
+ * Stable adaptive natural merge sort (TimSort) on a raw [first, last) range.
+ *
+ * - the input is split into natural runs; strictly descending runs are reversed in place,
+ *   runs shorter than minRun are extended with binary insertion sort;
+ * - runs are kept on a stack whose lengths satisfy the TimSort invariants, so merges stay balanced;
+ * - merges first trim the prefix and suffix that are already in place, then switch to galloping
+ *   (exponential search) once one run wins MIN_GALLOP times in a row.
+ *
+ * Sorted, reversed and partially sorted inputs take close to O(n). Requires T to provide operator<.
+ */
+template <typename T>
+class TimSort {
+public:
+    /**
+     * Sorts [first, last) in ascending order, stable.
+     * Time complexity: O(n log n) worst case, O(n) for inputs made of few runs; additional memory O(n / 2).
+     */
+    static void sort(T* first, T* last) {
+        const std::ptrdiff_t size = last - first;
+        if (size < 2) return;
+        TimSort sorter(first);
+        sorter.sortAll(size);
+    }
+
+private:
+    static constexpr std::ptrdiff_t MIN_MERGE = 32;
+    static constexpr std::ptrdiff_t MIN_GALLOP = 7;
+    /// Enough for any array addressable with 64-bit lengths, given the run length invariants.
+    static constexpr int MAX_RUNS = 85;
+
+    struct Run {
+        std::ptrdiff_t base;
+        std::ptrdiff_t length;
+    };
+
+    /// Cursors of a merge in progress, shared between the merge loop and the code finishing it.
+    struct MergeState {
+        std::ptrdiff_t cursor1;
+        std::ptrdiff_t cursor2;
+        std::ptrdiff_t destination;
+        std::ptrdiff_t length1;
+        std::ptrdiff_t length2;
+    };
+
+    T* data;
+    Vektor<T> buffer;
+    Run runs[MAX_RUNS];
+    int runCount = 0;
+    std::ptrdiff_t minGallop = MIN_GALLOP;
+
+    explicit TimSort(T* first) : data(first) {}
+
+    void sortAll(std::ptrdiff_t size) {
+        if (size < MIN_MERGE) {
+            const std::ptrdiff_t initialRun = countRunAndMakeAscending(0, size);
+            binaryInsertionSort(0, size, initialRun);
+            return;
+        }
+
+        const std::ptrdiff_t minRun = minRunLength(size);
+        std::ptrdiff_t low = 0;
+        std::ptrdiff_t remaining = size;
+        while (remaining != 0) {
+            std::ptrdiff_t runLength = countRunAndMakeAscending(low, low + remaining);
+            if (runLength < minRun) {
+                const std::ptrdiff_t forced = std::min(remaining, minRun);
+                binaryInsertionSort(low, low + forced, low + runLength);
+                runLength = forced;
+            }
+            runs[runCount++] = {low, runLength};
+            mergeCollapse();
+            low += runLength;
+            remaining -= runLength;
+        }
+        mergeForceCollapse();
+    }
+
+    /**
+     * Returns minRun in [MIN_MERGE / 2, MIN_MERGE] such that size / minRun is a power of two or slightly less,
+     * which keeps the final merges balanced.
+     */
+    static std::ptrdiff_t minRunLength(std::ptrdiff_t size) {
+        std::ptrdiff_t lowBits = 0;
+        while (size >= MIN_MERGE) {
+            lowBits |= size & 1;
+            size >>= 1;
+        }
+        return size + lowBits;
+    }
+
+    /**
+     * Returns the length of the run starting at low; a strictly descending run is reversed,
+     * strictness keeps equal elements in order.
+     */
+    std::ptrdiff_t countRunAndMakeAscending(std::ptrdiff_t low, std::ptrdiff_t high) {
+        std::ptrdiff_t runHigh = low + 1;
+        if (runHigh == high) return 1;
+
+        if (data[runHigh++] < data[low]) {
+            while (runHigh < high && data[runHigh] < data[runHigh - 1]) ++runHigh;
+            std::reverse(data + low, data + runHigh);
+        } else {
+            while (runHigh < high && !(data[runHigh] < data[runHigh - 1])) ++runHigh;
+        }
+        return runHigh - low;
+    }
+
+    /// Extends the sorted prefix [low, start) to [low, high) with binary insertion sort.
+    void binaryInsertionSort(std::ptrdiff_t low, std::ptrdiff_t high, std::ptrdiff_t start) {
+        BinaryInsertionSort<T>::extend(data + low, data + start, data + high);
+    }
+
+    /**
+     * Merges runs until, for the top runs X, Y, Z, W (W deepest): Z > Y + X, W > Z + Y and Y > X.
+     * Checking W as well keeps the invariant valid for the whole stack.
+     */
+    void mergeCollapse() {
+        while (runCount > 1) {
+            int n = runCount - 2;
+            if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length)
+                || (n > 1 && runs[n - 2].length <= runs[n].length + runs[n - 1].length)) {
+                if (runs[n - 1].length < runs[n + 1].length) --n;
+            } else if (runs[n].length > runs[n + 1].length) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
+
+    void mergeForceCollapse() {
+        while (runCount > 1) {
+            int n = runCount - 2;
+            if (n > 0 && runs[n - 1].length < runs[n + 1].length) --n;
+            mergeAt(n);
+        }
+    }
+
+    /// Merges stack runs i and i + 1.
+    void mergeAt(int i) {
+        std::ptrdiff_t base1 = runs[i].base;
+        std::ptrdiff_t length1 = runs[i].length;
+        const std::ptrdiff_t base2 = runs[i + 1].base;
+        std::ptrdiff_t length2 = runs[i + 1].length;
+
+        runs[i].length = length1 + length2;
+        if (i == runCount - 3) runs[i + 1] = runs[i + 2];
+        --runCount;
+
+        // Elements of run 1 not greater than the first of run 2, and elements of run 2 not less than
+        // the last of run 1, are already in place.
+        const std::ptrdiff_t skipped = gallopRight(data[base2], data + base1, length1, 0);
+        base1 += skipped;
+        length1 -= skipped;
+        if (length1 == 0) return;
+
+        length2 = gallopLeft(data[base1 + length1 - 1], data + base2, length2, length2 - 1);
+        if (length2 == 0) return;
+
+        if (length1 <= length2) mergeLow(base1, length1, base2, length2);
+        else mergeHigh(base1, length1, base2, length2);
+    }
+
+    /**
+     * Returns the leftmost position in the sorted range [base, base + length) at which key can be inserted,
+     * searching exponentially outwards from hint.
+     */
+    static std::ptrdiff_t gallopLeft(const T& key, const T* base, std::ptrdiff_t length, std::ptrdiff_t hint) {
+        std::ptrdiff_t lastOffset = 0;
+        std::ptrdiff_t offset = 1;
+        if (base[hint] < key) {
+            const std::ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && base[hint + offset] < key) {
+                lastOffset = offset;
+                offset = offset * 2 + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        } else {
+            const std::ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && !(base[hint - offset] < key)) {
+                lastOffset = offset;
+                offset = offset * 2 + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            const std::ptrdiff_t previous = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - previous;
+        }
+        // Now base[lastOffset] < key <= base[offset]; finish with a binary search.
+        return std::lower_bound(base + lastOffset + 1, base + offset, key) - base;
+    }
+
+    /// Like gallopLeft, but returns the rightmost insertion position (after all elements equal to key).
+    static std::ptrdiff_t gallopRight(const T& key, const T* base, std::ptrdiff_t length, std::ptrdiff_t hint) {
+        std::ptrdiff_t lastOffset = 0;
+        std::ptrdiff_t offset = 1;
+        if (key < base[hint]) {
+            const std::ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && key < base[hint - offset]) {
+                lastOffset = offset;
+                offset = offset * 2 + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            const std::ptrdiff_t previous = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - previous;
+        } else {
+            const std::ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && !(key < base[hint + offset])) {
+                lastOffset = offset;
+                offset = offset * 2 + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        }
+        return std::upper_bound(base + lastOffset + 1, base + offset, key) - base;
+    }
+
+    T* ensureBuffer(std::ptrdiff_t length) {
+        if (buffer.size() < length)
+            buffer = Vektor<T>(static_cast<int>(std::max<std::ptrdiff_t>(length, 2 * buffer.size())));
+        return buffer.begin();
+    }
+
+    /**
+     * Merges adjacent runs left to right, buffering the shorter run 1.
+     * Requires data[base1] > data[base2] and the last of run 1 > every element of run 2 after mergeAt's trimming.
+     */
+    void mergeLow(std::ptrdiff_t base1, std::ptrdiff_t length1, std::ptrdiff_t base2, std::ptrdiff_t length2) {
+        T* temp = ensureBuffer(length1);
+        std::move(data + base1, data + base1 + length1, temp);
+
+        MergeState state{0, base2, base1, length1, length2};
+        data[state.destination++] = std::move(data[state.cursor2++]);
+        if (--state.length2 != 0 && state.length1 != 1)
+            mergeLowLoop(temp, state);
+
+        if (state.length1 == 1) {
+            std::move(data + state.cursor2, data + state.cursor2 + state.length2, data + state.destination);
+            data[state.destination + state.length2] = std::move(temp[state.cursor1]);
+        } else {
+            std::move(temp + state.cursor1, temp + state.cursor1 + state.length1, data + state.destination);
+        }
+    }
+
+    /// Main loop of mergeLow; returns once run 2 is exhausted or one element of run 1 is left.
+    void mergeLowLoop(T* temp, MergeState& s) {
+        std::ptrdiff_t gallopThreshold = minGallop;
+        while (true) {
+            std::ptrdiff_t wins1 = 0;
+            std::ptrdiff_t wins2 = 0;
+
+            // One element at a time until one run keeps winning.
+            do {
+                if (data[s.cursor2] < temp[s.cursor1]) {
+                    data[s.destination++] = std::move(data[s.cursor2++]);
+                    ++wins2;
+                    wins1 = 0;
+                    if (--s.length2 == 0) return finishMerge(gallopThreshold);
+                } else {
+                    data[s.destination++] = std::move(temp[s.cursor1++]);
+                    ++wins1;
+                    wins2 = 0;
+                    if (--s.length1 == 1) return finishMerge(gallopThreshold);
+                }
+            } while ((wins1 | wins2) < gallopThreshold);
+
+            // Galloping: copy whole stretches found by exponential search.
+            do {
+                wins1 = gallopRight(data[s.cursor2], temp + s.cursor1, s.length1, 0);
+                if (wins1 != 0) {
+                    std::move(temp + s.cursor1, temp + s.cursor1 + wins1, data + s.destination);
+                    s.destination += wins1;
+                    s.cursor1 += wins1;
+                    s.length1 -= wins1;
+                    if (s.length1 <= 1) return finishMerge(gallopThreshold);
+                }
+                data[s.destination++] = std::move(data[s.cursor2++]);
+                if (--s.length2 == 0) return finishMerge(gallopThreshold);
+
+                wins2 = gallopLeft(temp[s.cursor1], data + s.cursor2, s.length2, 0);
+                if (wins2 != 0) {
+                    std::move(data + s.cursor2, data + s.cursor2 + wins2, data + s.destination);
+                    s.destination += wins2;
+                    s.cursor2 += wins2;
+                    s.length2 -= wins2;
+                    if (s.length2 == 0) return finishMerge(gallopThreshold);
+                }
+                data[s.destination++] = std::move(temp[s.cursor1++]);
+                if (--s.length1 == 1) return finishMerge(gallopThreshold);
+                --gallopThreshold;
+            } while (wins1 >= MIN_GALLOP || wins2 >= MIN_GALLOP);
+
+            // Galloping stopped paying off: make it harder to re-enter.
+            gallopThreshold = std::max<std::ptrdiff_t>(gallopThreshold, 0) + 2;
+        }
+    }
+
+    /**
+     * Merges adjacent runs right to left, buffering the shorter run 2.
+     */
+    void mergeHigh(std::ptrdiff_t base1, std::ptrdiff_t length1, std::ptrdiff_t base2, std::ptrdiff_t length2) {
+        T* temp = ensureBuffer(length2);
+        std::move(data + base2, data + base2 + length2, temp);
+
+        MergeState state{base1 + length1 - 1, length2 - 1, base2 + length2 - 1, length1, length2};
+        data[state.destination--] = std::move(data[state.cursor1--]);
+        if (--state.length1 != 0 && state.length2 != 1)
+            mergeHighLoop(temp, base1, state);
+
+        if (state.length2 == 1) {
+            state.destination -= state.length1;
+            state.cursor1 -= state.length1;
+            std::move_backward(data + state.cursor1 + 1, data + state.cursor1 + 1 + state.length1,
+                               data + state.destination + 1 + state.length1);
+            data[state.destination] = std::move(temp[state.cursor2]);
+        } else {
+            std::move(temp, temp + state.length2, data + state.destination - (state.length2 - 1));
+        }
+    }
+
+    /// Main loop of mergeHigh; returns once run 1 is exhausted or one element of run 2 is left.
+    void mergeHighLoop(T* temp, std::ptrdiff_t base1, MergeState& s) {
+        std::ptrdiff_t gallopThreshold = minGallop;
+        while (true) {
+            std::ptrdiff_t wins1 = 0;
+            std::ptrdiff_t wins2 = 0;
+
+            do {
+                if (temp[s.cursor2] < data[s.cursor1]) {
+                    data[s.destination--] = std::move(data[s.cursor1--]);
+                    ++wins1;
+                    wins2 = 0;
+                    if (--s.length1 == 0) return finishMerge(gallopThreshold);
+                } else {
+                    data[s.destination--] = std::move(temp[s.cursor2--]);
+                    ++wins2;
+                    wins1 = 0;
+                    if (--s.length2 == 1) return finishMerge(gallopThreshold);
+                }
+            } while ((wins1 | wins2) < gallopThreshold);
+
+            do {
+                wins1 = s.length1 - gallopRight(temp[s.cursor2], data + base1, s.length1, s.length1 - 1);
+                if (wins1 != 0) {
+                    s.destination -= wins1;
+                    s.cursor1 -= wins1;
+                    s.length1 -= wins1;
+                    std::move_backward(data + s.cursor1 + 1, data + s.cursor1 + 1 + wins1,
+                                       data + s.destination + 1 + wins1);
+                    if (s.length1 == 0) return finishMerge(gallopThreshold);
+                }
+                data[s.destination--] = std::move(temp[s.cursor2--]);
+                if (--s.length2 == 1) return finishMerge(gallopThreshold);
+
+                wins2 = s.length2 - gallopLeft(data[s.cursor1], temp, s.length2, s.length2 - 1);
+                if (wins2 != 0) {
+                    s.destination -= wins2;
+                    s.cursor2 -= wins2;
+                    s.length2 -= wins2;
+                    std::move(temp + s.cursor2 + 1, temp + s.cursor2 + 1 + wins2, data + s.destination + 1);
+                    if (s.length2 <= 1) return finishMerge(gallopThreshold);
+                }
+                data[s.destination--] = std::move(data[s.cursor1--]);
+                if (--s.length1 == 0) return finishMerge(gallopThreshold);
+                --gallopThreshold;
+            } while (wins1 >= MIN_GALLOP || wins2 >= MIN_GALLOP);
+
+            gallopThreshold = std::max<std::ptrdiff_t>(gallopThreshold, 0) + 2;
+        }
+    }
+
+    /// Keeps the adapted galloping threshold for the next merge.
+    void finishMerge(std::ptrdiff_t gallopThreshold) {
+        minGallop = std::max<std::ptrdiff_t>(gallopThreshold, 1);
+    }
+};
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Fixed-size thread pool with one task deque per participant.
+ * A participant pushes and pops its own tasks at the back (LIFO, cache-warm subproblems first)
+ * and, when its deque is empty, steals the oldest task from the front of another deque,
+ * which tends to be the largest remaining subproblem of a divide-and-conquer algorithm.
+ *
+ * The thread that constructed the pool counts as participant 0 and helps while it waits,
+ * so a pool of N threads starts N - 1 workers and a pool of 1 runs everything inline.
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkStealingPool(int threadCount)
+        : participantCount(threadCount < 1 ? 1 : threadCount),
+          queues(std::make_unique<TaskQueue[]>(participantCount)) {
+        workers.reserve(participantCount - 1);
+        for (int i = 1; i < participantCount; ++i)
+            workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            stopping = true;
+        }
+        idleCondition.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    int getThreadCount() const {
+        return participantCount;
+    }
+
+    /// Queues a task on the deque of the calling participant.
+    void submit(Task task) {
+        TaskQueue& queue = queues[currentIndex()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        queuedTasks.fetch_add(1, std::memory_order_release);
+        if (participantCount > 1) {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idleCondition.notify_one();
+        }
+    }
+
+    /**
+     * Runs one queued task on the calling thread: its own newest task, or else a stolen oldest one.
+     * Returns false when no task was available.
+     */
+    bool tryRunOne() {
+        const int self = currentIndex();
+        Task task;
+        if (!popBack(queues[self], task)) {
+            bool stolen = false;
+            for (int offset = 1; offset < participantCount && !stolen; ++offset)
+                stolen = popFront(queues[(self + offset) % participantCount], task);
+            if (!stolen)
+                return false;
+        }
+        queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    /**
+     * Blocks the caller until a task is queued or pending drops to zero; used by TaskGroup::wait
+     * once stealing keeps failing, so a waiting thread sleeps instead of burning a core.
+     */
+    void waitForWorkOr(const std::atomic<int>& pending) {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idleCondition.wait(lock, [&]() {
+            return queuedTasks.load(std::memory_order_acquire) > 0 || pending.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    /// Wakes every thread blocked in waitForWorkOr or idle in the worker loop.
+    void notifyWaiters() {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        idleCondition.notify_all();
+    }
+
+private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    const int participantCount;
+    std::unique_ptr<TaskQueue[]> queues;
+    Vektor<std::thread> workers;
+
+    std::atomic<int> queuedTasks{0};
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    bool stopping = false;
+
+    static inline thread_local const WorkStealingPool* currentPool = nullptr;
+    static inline thread_local int currentWorker = 0;
+
+    /// Index of the calling thread's deque; threads that are not workers of this pool use deque 0.
+    int currentIndex() const {
+        return currentPool == this ? currentWorker : 0;
+    }
+
+    void workerLoop(int index) {
+        currentPool = this;
+        currentWorker = index;
+        while (true) {
+            if (tryRunOne())
+                continue;
+            std::unique_lock<std::mutex> lock(idleMutex);
+            idleCondition.wait(lock, [this]() {
+                return stopping || queuedTasks.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping)
+                return;
+        }
+    }
+
+    static bool popBack(TaskQueue& queue, Task& task) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    static bool popFront(TaskQueue& queue, Task& task) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+};
+
+/**
+ * Fork-join scope on a WorkStealingPool: run() spawns a subtask, wait() returns once all spawned
+ * subtasks finished, executing queued tasks on the calling thread in the meantime.
+ */
+class TaskGroup {
+    /// Failed steal attempts, each followed by a yield, before wait() blocks.
+    static constexpr int SPIN_ATTEMPTS = 16;
+
+    WorkStealingPool& pool;
+    std::atomic<int> pending{0};
+
+public:
+    explicit TaskGroup(WorkStealingPool& workStealingPool) : pool(workStealingPool) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        wait();
+    }
+
+    WorkStealingPool& getPool() const {
+        return pool;
+    }
+
+    template <typename Function>
+    void run(Function&& function) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        pool.submit([this, &workPool = pool, function = std::forward<Function>(function)]() mutable {
+            function();
+            // The group may be destroyed as soon as pending reaches zero, so only the pool is touched afterwards.
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                workPool.notifyWaiters();
+        });
+    }
+
+    void wait() {
+        int failedAttempts = 0;
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (pool.tryRunOne()) {
+                failedAttempts = 0;
+            } else if (++failedAttempts < SPIN_ATTEMPTS) {
+                std::this_thread::yield();
+            } else {
+                pool.waitForWorkOr(pending);
+                failedAttempts = 0;
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "PerfCounters.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    enum Event { CYCLES = 0, INSTRUCTIONS = 1, BRANCHES = 2, BRANCH_MISSES = 3 };
+}
+
+PerfCounters::PerfCounters() : descriptors{-1, -1, -1, -1}, values{0, 0, 0, 0}, available(false) {
+#ifdef __linux__
+    const unsigned long long configs[EVENT_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (int i = 0; i < EVENT_COUNT; ++i) {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = configs[i];
+        attributes.disabled = i == CYCLES ? 1 : 0;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_GROUP;
+
+        // The first event leads the group, so all four are enabled and read together.
+        const int groupLeader = i == CYCLES ? -1 : descriptors[CYCLES];
+        descriptors[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+        if (descriptors[i] < 0) {
+            closeAll();
+            return;
+        }
+    }
+    available = true;
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+    closeAll();
+}
+
+bool PerfCounters::isAvailable() const {
+    return available;
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    if (!available) return;
+    ioctl(descriptors[CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(descriptors[CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+void PerfCounters::stop() {
+#ifdef __linux__
+    if (!available) return;
+    ioctl(descriptors[CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP layout: number of events followed by one value per event.
+    unsigned long long buffer[1 + EVENT_COUNT] = {};
+    if (read(descriptors[CYCLES], buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+        for (int i = 0; i < EVENT_COUNT; ++i)
+            values[i] = static_cast<long long>(buffer[1 + i]);
+    }
+#endif
+}
+
+long long PerfCounters::cycles() const {
+    return values[CYCLES];
+}
+
+long long PerfCounters::instructions() const {
+    return values[INSTRUCTIONS];
+}
+
+long long PerfCounters::branches() const {
+    return values[BRANCHES];
+}
+
+long long PerfCounters::branchMisses() const {
+    return values[BRANCH_MISSES];
+}
+
+void PerfCounters::closeAll() {
+#ifdef __linux__
+    for (int i = EVENT_COUNT - 1; i >= 0; --i) {
+        if (descriptors[i] >= 0)
+            close(descriptors[i]);
+        descriptors[i] = -1;
+    }
+#endif
+    available = false;
+}
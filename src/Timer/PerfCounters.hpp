@@ -0,0 +1,37 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+/**
+ * Hardware performance counters of the calling thread (user space only), read through perf_event_open on Linux.
+ * Counts cycles, instructions, branches and branch misses between start() and stop().
+ * When the counters cannot be opened (other OS, containers, perf_event_paranoid) isAvailable() is false
+ * and all values stay 0.
+ */
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool isAvailable() const;
+    void start();
+    void stop();
+
+    long long cycles() const;
+    long long instructions() const;
+    long long branches() const;
+    long long branchMisses() const;
+
+private:
+    static constexpr int EVENT_COUNT = 4;
+
+    int descriptors[EVENT_COUNT];
+    long long values[EVENT_COUNT];
+    bool available;
+
+    void closeAll();
+};
+
+#endif
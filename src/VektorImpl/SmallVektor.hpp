@@ -0,0 +1,188 @@
+#ifndef SMALL_VEKTOR_HPP
+#define SMALL_VEKTOR_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vektor.hpp"
+
+/**
+ * Vektor variant with inline storage for the first InlineCapacity elements.
+ * Small instances never touch the heap; once they outgrow the inline buffer the elements
+ * move to storage from the memory resource captured at construction, growing by GrowthPolicy.
+ * Exposes the subset of the Vektor interface used by adjacency lists.
+ */
+template <typename T, int InlineCapacity, typename GrowthPolicy = DoublingGrowth,
+          typename AccessPolicy = DefaultAccessPolicy>
+class SmallVektor {
+    static_assert(InlineCapacity > 0, "SmallVektor needs at least one inline slot");
+    static constexpr bool bitwiseCopyable = std::is_trivially_copyable_v<T>;
+
+    T* data;
+    int capacity;
+    int count;
+    std::pmr::memory_resource* resource;
+    alignas(T) unsigned char inlineStorage[sizeof(T) * InlineCapacity];
+
+public:
+    SmallVektor()
+        : data(inlineData()), capacity(InlineCapacity), count(0), resource(std::pmr::get_default_resource()) {}
+
+    SmallVektor(const SmallVektor& other) : SmallVektor() {
+        insertEnd(other.begin(), other.end());
+    }
+
+    SmallVektor(SmallVektor&& other) noexcept
+        : data(inlineData()), capacity(InlineCapacity), count(0), resource(other.resource) {
+        takeFrom(other);
+    }
+
+    SmallVektor& operator=(const SmallVektor& other) {
+        if (this != &other) {
+            clear();
+            insertEnd(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    /// Not noexcept: with different memory resources the elements move into storage allocated from ours.
+    SmallVektor& operator=(SmallVektor&& other) {
+        if (this != &other) {
+            clear();
+            releaseHeapStorage();
+            if (resource == other.resource || resource->is_equal(*other.resource)) {
+                takeFrom(other);
+            } else {
+                reserve(other.count);
+                std::uninitialized_move(other.begin(), other.end(), data);
+                count = other.count;
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~SmallVektor() {
+        clear();
+        releaseHeapStorage();
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (count >= capacity) {
+            T value(std::forward<Args>(args)...);
+            relocate(GrowthPolicy::nextCapacity(capacity, count + 1));
+            ::new (static_cast<void*>(data + count)) T(std::move(value));
+        } else {
+            ::new (static_cast<void*>(data + count)) T(std::forward<Args>(args)...);
+        }
+        return data[count++];
+    }
+
+    /// Appends [first, last) with at most one reallocation. The range must not point into this vector.
+    void insertEnd(const T* first, const T* last) {
+        const int insertCount = static_cast<int>(last - first);
+        if (count + insertCount > capacity)
+            relocate(GrowthPolicy::nextCapacity(capacity, count + insertCount));
+        std::uninitialized_copy(first, last, data + count);
+        count += insertCount;
+    }
+
+    void reserve(int newCapacity) {
+        if (newCapacity > capacity)
+            relocate(newCapacity);
+    }
+
+    void clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            std::destroy(data, data + count);
+        count = 0;
+    }
+
+    int size() const { return count; }
+    int getCapacity() const { return capacity; }
+    bool empty() const { return count == 0; }
+    bool isInline() const { return data == inlineData(); }
+
+    T& operator[](int index) {
+        if constexpr (AccessPolicy::checked) {
+            if (index < 0 || index >= count)
+                throw std::out_of_range("Index out of range");
+        }
+        return data[index];
+    }
+
+    const T& operator[](int index) const {
+        if constexpr (AccessPolicy::checked) {
+            if (index < 0 || index >= count)
+                throw std::out_of_range("Index out of range");
+        }
+        return data[index];
+    }
+
+    // Iterator support
+    T* begin() { return data; }
+    T* end() { return data + count; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + count; }
+
+private:
+    T* inlineData() { return reinterpret_cast<T*>(inlineStorage); }
+    const T* inlineData() const { return reinterpret_cast<const T*>(inlineStorage); }
+
+    /// Moves the elements to a heap buffer of newCapacity elements.
+    void relocate(int newCapacity) {
+        const std::size_t bytes = sizeof(T) * static_cast<std::size_t>(newCapacity);
+        VektorAllocationStats::allocations.fetch_add(1, std::memory_order_relaxed);
+        VektorAllocationStats::bytes.fetch_add(static_cast<long long>(bytes), std::memory_order_relaxed);
+        T* newData = static_cast<T*>(resource->allocate(bytes, alignof(T)));
+        moveElements(data, count, newData);
+        releaseHeapStorage();
+        data = newData;
+        capacity = newCapacity;
+    }
+
+    /// Steals a heap buffer or moves inline elements out of other, leaving it empty and inline.
+    void takeFrom(SmallVektor& other) {
+        if (other.isInline()) {
+            moveElements(other.data, other.count, data);
+            count = other.count;
+        } else {
+            data = other.data;
+            capacity = other.capacity;
+            count = other.count;
+            other.data = other.inlineData();
+            other.capacity = InlineCapacity;
+        }
+        other.count = 0;
+    }
+
+    static void moveElements(T* source, int elements, T* destination) {
+        if constexpr (bitwiseCopyable) {
+            if (elements > 0)
+                std::memcpy(static_cast<void*>(destination), source, sizeof(T) * static_cast<std::size_t>(elements));
+        } else {
+            std::uninitialized_move(source, source + elements, destination);
+            std::destroy(source, source + elements);
+        }
+    }
+
+    void releaseHeapStorage() {
+        if (!isInline()) {
+            resource->deallocate(data, sizeof(T) * static_cast<std::size_t>(capacity), alignof(T));
+            data = inlineData();
+            capacity = InlineCapacity;
+        }
+    }
+};
+
+#endif
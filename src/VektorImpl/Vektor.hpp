@@ -3,21 +3,64 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-template <typename T>
+#include "VektorGrowthPolicy.hpp"
+#include "VektorAccessPolicy.hpp"
+
+/**
+ * Global counters of buffer allocations performed by every Vektor instantiation.
+ * Used by allocation benchmarks to compare construction pipelines.
+ */
+struct VektorAllocationStats {
+    static inline std::atomic<long long> allocations{0};
+    static inline std::atomic<long long> bytes{0};
+
+    static void reset() {
+        allocations.store(0, std::memory_order_relaxed);
+        bytes.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Dynamic array with lazy, policy-driven growth.
+ * Storage comes from a std::pmr::memory_resource chosen at construction (the current default resource
+ * unless one is passed explicitly), so temporaries can be served from a per-run arena.
+ */
+template <typename T, typename GrowthPolicy = DoublingGrowth, typename AccessPolicy = DefaultAccessPolicy>
 class Vektor {
 public:
     Vektor();
+    explicit Vektor(std::pmr::memory_resource* memoryResource);
     Vektor(int initialSize);
-    Vektor(const Vektor<T>& other);
-    Vektor<T>& operator=(const Vektor<T>& other);
+    Vektor(int initialSize, std::pmr::memory_resource* memoryResource);
+    Vektor(const Vektor& other);
+    Vektor(Vektor&& other) noexcept;
+    Vektor& operator=(const Vektor& other);
+    Vektor& operator=(Vektor&& other);
     ~Vektor();
 
     void push_back(const T& value);
+    void push_back(T&& value);
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
     void insertEnd(const T* first, const T* last);
+    void append_n(int n, const T& value);
+
+    void reserve(int newCapacity);
+    void shrink_to_fit();
+    void clear();
 
     int size() const;
+    int getCapacity() const;
     bool empty() const;
+    std::pmr::memory_resource* getResource() const;
 
     void removeAt(int index);
     T& operator[](int index);
@@ -30,143 +73,340 @@ public:
     const T* end() const;
 
 private:
+    static constexpr bool bitwiseCopyable = std::is_trivially_copyable_v<T>;
+
     T* data;
     int capacity;
     int count;
+    std::pmr::memory_resource* resource;
 
     void resize(int newCapacity);
+    void growFor(int requiredCapacity);
+    T* allocateStorage(int elements);
+    void releaseStorage(T* storage, int elements);
+    static void destroyRange(T* first, T* last);
+    static void copyIntoRaw(const T* first, const T* last, T* destination);
 };
 
 // --- Implementation ---
 
-template <typename T>
-Vektor<T>::Vektor() : capacity(10), count(0) {
-    data = new T[capacity];
+/**
+ * Creates an empty vector without touching the heap.
+ * Storage is allocated lazily by the first insertion or reserve().
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor()
+    : Vektor(std::pmr::get_default_resource()) {}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor(std::pmr::memory_resource* memoryResource)
+    : data(nullptr), capacity(0), count(0), resource(memoryResource) {}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor(int initialSize)
+    : Vektor(initialSize, std::pmr::get_default_resource()) {}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor(int initialSize, std::pmr::memory_resource* memoryResource)
+    : data(nullptr), capacity(initialSize), count(0), resource(memoryResource) {
+    data = allocateStorage(capacity);
+    std::uninitialized_value_construct(data, data + initialSize);
+    count = initialSize;
 }
 
-template <typename T>
-Vektor<T>::Vektor(int initialSize)
-    : capacity(initialSize), count(initialSize) {
-    data = new T[capacity];
-    for (int i = 0; i < count; ++i) {
-        data[i] = T();
-    }
+/**
+ * Copies take their storage from the current default resource, like std::pmr containers,
+ * so copying out of a per-run arena yields a vector that outlives the arena.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor(const Vektor& other)
+    : data(nullptr), capacity(other.count), count(0), resource(std::pmr::get_default_resource()) {
+    data = allocateStorage(capacity);
+    copyIntoRaw(other.data, other.data + other.count, data);
+    count = other.count;
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::Vektor(Vektor&& other) noexcept
+    : data(other.data), capacity(other.capacity), count(other.count), resource(other.resource) {
+    other.data = nullptr;
+    other.capacity = 0;
+    other.count = 0;
 }
 
-template <typename T>
-Vektor<T>::Vektor(const Vektor<T>& other)
-    : capacity(other.capacity), count(other.count) {
-    data = new T[capacity];
-    for (int i = 0; i < count; i++) {
-        data[i] = other.data[i];
+/**
+ * Assignments keep this vector's memory resource.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>& Vektor<T, GrowthPolicy, AccessPolicy>::operator=(const Vektor& other) {
+    if (this != &other) {
+        Vektor copy(resource);
+        copy.insertEnd(other.begin(), other.end());
+        *this = std::move(copy);
     }
+    return *this;
 }
 
-template <typename T>
-Vektor<T>& Vektor<T>::operator=(const Vektor<T>& other) {
+/**
+ * Steals the buffer when both vectors share a memory resource, otherwise moves the elements one by one.
+ * Not noexcept, like std::pmr::vector: the element-wise path allocates from this vector's resource.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>& Vektor<T, GrowthPolicy, AccessPolicy>::operator=(Vektor&& other) {
     if (this != &other) {
-        delete[] data;
+        if (resource != other.resource && !resource->is_equal(*other.resource)) {
+            clear();
+            reserve(other.count);
+            std::uninitialized_move(other.data, other.data + other.count, data);
+            count = other.count;
+            other.clear();
+            return *this;
+        }
+        destroyRange(data, data + count);
+        releaseStorage(data, capacity);
+        data = other.data;
         capacity = other.capacity;
         count = other.count;
-        data = new T[capacity];
-        for (int i = 0; i < count; i++) {
-            data[i] = other.data[i];
-        }
+        other.data = nullptr;
+        other.capacity = 0;
+        other.count = 0;
     }
     return *this;
 }
 
-template <typename T>
-Vektor<T>::~Vektor() {
-    delete[] data;
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+Vektor<T, GrowthPolicy, AccessPolicy>::~Vektor() {
+    destroyRange(data, data + count);
+    releaseStorage(data, capacity);
 }
 
-template <typename T>
-int Vektor<T>::size() const {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+int Vektor<T, GrowthPolicy, AccessPolicy>::size() const {
     return count;
 }
 
-template <typename T>
-bool Vektor<T>::empty() const {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+int Vektor<T, GrowthPolicy, AccessPolicy>::getCapacity() const {
+    return capacity;
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+bool Vektor<T, GrowthPolicy, AccessPolicy>::empty() const {
     return count == 0;
 }
 
-template <typename T>
-T& Vektor<T>::operator[](int index) {
-    if (index < 0 || index >= count)
-        throw std::out_of_range("Index out of range");
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+std::pmr::memory_resource* Vektor<T, GrowthPolicy, AccessPolicy>::getResource() const {
+    return resource;
+}
+
+/**
+ * Element access; the bounds check exists only when AccessPolicy::checked is true.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+T& Vektor<T, GrowthPolicy, AccessPolicy>::operator[](int index) {
+    if constexpr (AccessPolicy::checked) {
+        if (index < 0 || index >= count)
+            throw std::out_of_range("Index out of range");
+    }
     return data[index];
 }
 
-template <typename T>
-const T& Vektor<T>::operator[](int index) const {
-    if (index < 0 || index >= count)
-        throw std::out_of_range("Index out of range");
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+const T& Vektor<T, GrowthPolicy, AccessPolicy>::operator[](int index) const {
+    if constexpr (AccessPolicy::checked) {
+        if (index < 0 || index >= count)
+            throw std::out_of_range("Index out of range");
+    }
     return data[index];
 }
 
-template <typename T>
-void Vektor<T>::push_back(const T& value) {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+/**
+ * Constructs a new element in place at the end of the vector.
+ * The argument is materialized before growing, so pushing an element of this vector is safe.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+template <typename... Args>
+T& Vektor<T, GrowthPolicy, AccessPolicy>::emplace_back(Args&&... args) {
     if (count >= capacity) {
-        capacity++;
-        resize(static_cast<int>(capacity * 1.5) + 1);
+        T value(std::forward<Args>(args)...);
+        growFor(count + 1);
+        ::new (static_cast<void*>(data + count)) T(std::move(value));
+    } else {
+        ::new (static_cast<void*>(data + count)) T(std::forward<Args>(args)...);
     }
-    data[count++] = value;
+    return data[count++];
+}
+
+/**
+ * Grows the storage to hold at least newCapacity elements without changing size().
+ * Time complexity: O(n) when reallocation happens, O(1) otherwise.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::reserve(int newCapacity) {
+    if (newCapacity > capacity)
+        resize(newCapacity);
+}
+
+/**
+ * Releases unused capacity so that getCapacity() == size().
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::shrink_to_fit() {
+    if (capacity > count)
+        resize(count);
 }
 
-template <typename T>
-void Vektor<T>::resize(int newCapacity) {
-    T* newData = new T[newCapacity];
-    for (int i = 0; i < count; i++) {
-        newData[i] = data[i];
+/**
+ * Destroys all elements but keeps the allocated storage for reuse.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::clear() {
+    destroyRange(data, data + count);
+    count = 0;
+}
+
+/**
+ * Asks the growth policy for a capacity that fits requiredCapacity elements and reallocates once.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::growFor(int requiredCapacity) {
+    if (requiredCapacity > capacity)
+        resize(GrowthPolicy::nextCapacity(capacity, requiredCapacity));
+}
+
+/**
+ * Moves the elements into a new buffer; trivially copyable types are relocated with a single memcpy.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::resize(int newCapacity) {
+    T* newData = allocateStorage(newCapacity);
+    if constexpr (bitwiseCopyable) {
+        if (count > 0)
+            std::memcpy(static_cast<void*>(newData), data, sizeof(T) * static_cast<std::size_t>(count));
+    } else {
+        std::uninitialized_move(data, data + count, newData);
+        destroyRange(data, data + count);
     }
-    delete[] data;
+    releaseStorage(data, capacity);
     data = newData;
     capacity = newCapacity;
 }
 
-template <typename T>
-void Vektor<T>::removeAt(int index) {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::removeAt(int index) {
     if (index < 0 || index >= count)
         throw std::out_of_range("Index out of range in removeAt");
-    for (int i = index; i < count - 1; ++i) {
-        data[i] = data[i + 1];
+    if constexpr (bitwiseCopyable) {
+        std::memmove(static_cast<void*>(data + index), data + index + 1,
+                     sizeof(T) * static_cast<std::size_t>(count - index - 1));
+        --count;
+    } else {
+        std::move(data + index + 1, data + count, data + index);
+        --count;
+        data[count].~T();
+    }
+}
+
+// --- Raw storage ---
+
+/**
+ * Allocates uninitialized storage from the memory resource; elements are placed into it with placement new.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+T* Vektor<T, GrowthPolicy, AccessPolicy>::allocateStorage(int elements) {
+    if (elements <= 0)
+        return nullptr;
+    const std::size_t bytes = sizeof(T) * static_cast<std::size_t>(elements);
+    VektorAllocationStats::allocations.fetch_add(1, std::memory_order_relaxed);
+    VektorAllocationStats::bytes.fetch_add(static_cast<long long>(bytes), std::memory_order_relaxed);
+    return static_cast<T*>(resource->allocate(bytes, alignof(T)));
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::releaseStorage(T* storage, int elements) {
+    if (!storage)
+        return;
+    resource->deallocate(storage, sizeof(T) * static_cast<std::size_t>(elements), alignof(T));
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::destroyRange(T* first, T* last) {
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        std::destroy(first, last);
+}
+
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::copyIntoRaw(const T* first, const T* last, T* destination) {
+    if constexpr (bitwiseCopyable) {
+        if (last > first)
+            std::memcpy(static_cast<void*>(destination), first, sizeof(T) * static_cast<std::size_t>(last - first));
+    } else {
+        std::uninitialized_copy(first, last, destination);
     }
-    --count;
 }
 
 // --- Iterator methods ---
 
-template <typename T>
-T* Vektor<T>::begin() {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+T* Vektor<T, GrowthPolicy, AccessPolicy>::begin() {
     return data;
 }
 
-template <typename T>
-T* Vektor<T>::end() {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+T* Vektor<T, GrowthPolicy, AccessPolicy>::end() {
     return data + count;
 }
 
-template <typename T>
-const T* Vektor<T>::begin() const {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+const T* Vektor<T, GrowthPolicy, AccessPolicy>::begin() const {
     return data;
 }
 
-template <typename T>
-const T* Vektor<T>::end() const {
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+const T* Vektor<T, GrowthPolicy, AccessPolicy>::end() const {
     return data + count;
 }
 
 // --- Bulk insert ---
 
-template <typename T>
-void Vektor<T>::insertEnd(const T* first, const T* last) {
-    int insertCount = static_cast<int>(last - first);
-    if (count + insertCount > capacity)
-        resize((count + insertCount) * 2);
-
-    std::copy(first, last, data + count);
+/**
+ * Appends the range [first, last) with at most one reallocation.
+ * The range must not point into this vector.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::insertEnd(const T* first, const T* last) {
+    const int insertCount = static_cast<int>(last - first);
+    growFor(count + insertCount);
+    copyIntoRaw(first, last, data + count);
     count += insertCount;
 }
 
+/**
+ * Appends n copies of value with at most one reallocation.
+ */
+template <typename T, typename GrowthPolicy, typename AccessPolicy>
+void Vektor<T, GrowthPolicy, AccessPolicy>::append_n(int n, const T& value) {
+    if (n <= 0)
+        return;
+    if (count + n > capacity) {
+        T copy(value);
+        growFor(count + n);
+        std::uninitialized_fill_n(data + count, n, copy);
+    } else {
+        std::uninitialized_fill_n(data + count, n, value);
+    }
+    count += n;
+}
+
 #endif
@@ -0,0 +1,27 @@
+#ifndef VEKTOR_ACCESS_POLICY_HPP
+#define VEKTOR_ACCESS_POLICY_HPP
+
+/**
+ * Access policies select at compile time whether operator[] validates indices.
+ * Checked access throws std::out_of_range, unchecked access compiles to a plain load
+ * so hot loops can be inlined and auto-vectorized.
+ */
+struct CheckedAccess {
+    static constexpr bool checked = true;
+};
+
+struct UncheckedAccess {
+    static constexpr bool checked = false;
+};
+
+/**
+ * Debug/test builds (no NDEBUG) keep bounds checks, release builds drop them.
+ * Defining AIZO_CHECKED_ACCESS forces checked access in every build type.
+ */
+#if defined(AIZO_CHECKED_ACCESS) || !defined(NDEBUG)
+using DefaultAccessPolicy = CheckedAccess;
+#else
+using DefaultAccessPolicy = UncheckedAccess;
+#endif
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef VEKTOR_GROWTH_POLICY_HPP
+#define VEKTOR_GROWTH_POLICY_HPP
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * Geometric growth policy: the next capacity is current * Numerator / Denominator,
+ * but never less than the requested number of elements.
+ */
+template <int Numerator, int Denominator, int InitialCapacity = 4>
+struct GeometricGrowth {
+    static_assert(Numerator > Denominator, "Growth factor must be greater than 1");
+
+    static int nextCapacity(int currentCapacity, int requiredCapacity) {
+        if (currentCapacity <= 0)
+            return std::max(requiredCapacity, InitialCapacity);
+        const long long grown = static_cast<long long>(currentCapacity) * Numerator / Denominator;
+        const long long limited = std::min<long long>(grown, std::numeric_limits<int>::max());
+        return std::max(requiredCapacity, static_cast<int>(limited));
+    }
+};
+
+/// Default policy: capacity doubles on every reallocation.
+using DoublingGrowth = GeometricGrowth<2, 1>;
+
+/// Previous Vektor behaviour: capacity grows by roughly 1.5x.
+using HalfStepGrowth = GeometricGrowth<3, 2>;
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef EDGE_HASH_SET_HPP
+#define EDGE_HASH_SET_HPP
+
+#include <cstdint>
+
+#include "../VektorImpl/Vektor.hpp"
+
+/**
+ * Set of undirected edges {u, v} with open addressing and linear probing.
+ * Both endpoint orders map to the same 64-bit key (min << 32 | max), so (u, v) and (v, u) are one edge.
+ * The table is a power of two kept at most half full, which gives O(1) expected insert and lookup
+ * and replaces the linear scans over already seen pairs that made edge deduplication O(E^2).
+ */
+class EdgeHashSet {
+    static constexpr std::uint64_t EMPTY = ~std::uint64_t{0};
+
+    Vektor<std::uint64_t> slots;
+    std::uint64_t mask = 0;
+    int count = 0;
+
+public:
+    /// Creates a set that holds expectedEdges edges without rehashing.
+    explicit EdgeHashSet(int expectedEdges = 0) {
+        allocate(capacityFor(expectedEdges));
+    }
+
+    /**
+     * Adds the edge; returns false if it was already present.
+     * Time complexity: O(1) expected, amortized over rehashing.
+     */
+    bool insert(int u, int v) {
+        if (2 * (count + 1) > slots.size())
+            rehash(2 * slots.size());
+        const std::uint64_t key = makeKey(u, v);
+        std::uint64_t slot = hash(key) & mask;
+        while (slots[static_cast<int>(slot)] != EMPTY) {
+            if (slots[static_cast<int>(slot)] == key) return false;
+            slot = (slot + 1) & mask;
+        }
+        slots[static_cast<int>(slot)] = key;
+        ++count;
+        return true;
+    }
+
+    /**
+     * Time complexity: O(1) expected.
+     */
+    bool contains(int u, int v) const {
+        const std::uint64_t key = makeKey(u, v);
+        std::uint64_t slot = hash(key) & mask;
+        while (slots[static_cast<int>(slot)] != EMPTY) {
+            if (slots[static_cast<int>(slot)] == key) return true;
+            slot = (slot + 1) & mask;
+        }
+        return false;
+    }
+
+    int size() const {
+        return count;
+    }
+
+private:
+    static std::uint64_t makeKey(int u, int v) {
+        const auto a = static_cast<std::uint32_t>(u < v ? u : v);
+        const auto b = static_cast<std::uint32_t>(u < v ? v : u);
+        return (static_cast<std::uint64_t>(a) << 32) | b;
+    }
+
+    /// Murmur3 finalizer: consecutive vertex pairs must not land in consecutive slots.
+    static std::uint64_t hash(std::uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return key;
+    }
+
+    static int capacityFor(int elements) {
+        int capacity = 16;
+        while (capacity < 2 * elements) capacity *= 2;
+        return capacity;
+    }
+
+    void allocate(int capacity) {
+        slots.clear();
+        slots.reserve(capacity);
+        slots.append_n(capacity, EMPTY);
+        mask = static_cast<std::uint64_t>(capacity - 1);
+        count = 0;
+    }
+
+    void rehash(int capacity) {
+        Vektor<std::uint64_t> old = std::move(slots);
+        allocate(capacity);
+        for (int i = 0; i < old.size(); ++i) {
+            const std::uint64_t key = old[i];
+            if (key == EMPTY) continue;
+            std::uint64_t slot = hash(key) & mask;
+            while (slots[static_cast<int>(slot)] != EMPTY)
+                slot = (slot + 1) & mask;
+            slots[static_cast<int>(slot)] = key;
+            ++count;
+        }
+    }
+};
+
+#endif
@@ -1,19 +1,45 @@
 #ifndef GRAPH_FACTORY_HPP
 #define GRAPH_FACTORY_HPP
 
+#include <optional>
+#include <variant>
+
 #include "../GraphsImpl//GraphList.hpp"
 #include "../GraphsImpl/GraphMatrix.hpp"
+#include "../GraphsImpl/GraphCSR.hpp"
+#include "../GraphsImpl/GraphDense.hpp"
+#include "../GraphsImpl/GraphConcept.hpp"
+#include "../GraphsImpl/GraphBuilder.hpp"
 #include "GraphRepresentingShape.hpp"
 
-inline IGraph* createGraphInstance(GraphRepresentingShape type, int vertices, int edges) {
+static_assert(GraphRepresentation<GraphList>);
+static_assert(GraphRepresentation<SmallGraphList>);
+static_assert(GraphRepresentation<GraphMatrix>);
+static_assert(GraphRepresentation<GraphCSR>);
+static_assert(GraphRepresentation<GraphDense>);
+
+/// Graph whose representation is chosen at runtime; work on it is dispatched once with std::visit.
+using AnyGraph = std::variant<GraphList, GraphMatrix, GraphCSR, GraphDense>;
+
+/**
+ * Builds a graph of the requested representation from a complete edge list.
+ * Returns std::nullopt for shapes that are not a single representation.
+ * Time complexity: see GraphBuilder::build.
+ */
+inline std::optional<AnyGraph> createGraphInstance(GraphRepresentingShape type, int vertices,
+                                                   const Vektor<EdgeTriple>& edges) {
     switch (type) {
         case LIST:
-            return new GraphList(vertices);
+            return AnyGraph(std::in_place_type<GraphList>, GraphBuilder::build<GraphList>(vertices, edges));
         case MATRIX:
-            return new GraphMatrix(vertices, edges);
+            return AnyGraph(std::in_place_type<GraphMatrix>, GraphBuilder::build<GraphMatrix>(vertices, edges));
+        case CSR:
+            return AnyGraph(std::in_place_type<GraphCSR>, GraphBuilder::build<GraphCSR>(vertices, edges));
+        case DENSE:
+            return AnyGraph(std::in_place_type<GraphDense>, GraphBuilder::build<GraphDense>(vertices, edges));
         default:
             std::cerr << "[ERROR] Unknown graph type\n";
-        return nullptr;
+        return std::nullopt;
     }
 }
 
@@ -4,7 +4,20 @@
 enum GraphRepresentingShape {
     LIST,
     MATRIX,
+    CSR,
+    DENSE,
     BOTH
 };
 
+/// Name written to history and summary files for a representation.
+inline const char* getShapeName(GraphRepresentingShape shape) {
+    switch (shape) {
+        case LIST: return "LIST";
+        case MATRIX: return "MATRIX";
+        case CSR: return "CSR";
+        case DENSE: return "DENSE";
+        default: return "BOTH";
+    }
+}
+
 #endif
@@ -0,0 +1,26 @@
+#ifndef SIMD_SUPPORT_HPP
+#define SIMD_SUPPORT_HPP
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+// Kernels are compiled for AVX2 regardless of -march and only called after the runtime CPU check.
+#define SIMD_AVX2 __attribute__((target("avx2")))
+#endif
+
+/**
+ * Runtime CPU feature detection for the SIMD kernels of the sorts and the dense graph algorithms.
+ */
+class SimdSupport {
+public:
+    static bool hasAvx2() {
+#ifdef SIMD_X86
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+};
+
+#endif
@@ -3,11 +3,16 @@
 
 #include "../VektorImpl/Vektor.hpp"
 
-class UnionJoinSet {
-    Vektor<int> parent;
+/**
+ * Disjoint-set forest with path compression.
+ * AccessPolicy selects checked or unchecked element access of the parent array.
+ */
+template <typename AccessPolicy = DefaultAccessPolicy>
+class BasicUnionJoinSet {
+    Vektor<int, DoublingGrowth, AccessPolicy> parent;
 
 public:
-    explicit UnionJoinSet(int n) : parent(n) {
+    explicit BasicUnionJoinSet(int n) : parent(n) {
         for (int i = 0; i < n; ++i) parent[i] = i;
     }
 
@@ -21,4 +26,6 @@ public:
     }
 };
 
+using UnionJoinSet = BasicUnionJoinSet<>;
+
 #endif